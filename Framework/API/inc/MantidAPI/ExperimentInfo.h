@@ -120,8 +120,11 @@ public:
   void saveExperimentInfoNexus(::NeXus::File *file, bool saveInstrument,
                                bool saveSample, bool saveLogs) const;
   /// Loads an experiment description from the open NeXus file
-  void loadExperimentInfoNexus(const std::string &nxFilename,
-                               ::NeXus::File *file, std::string &parameterStr);
+  void loadExperimentInfoNexus(
+      const std::string &nxFilename, ::NeXus::File *file,
+      std::string &parameterStr,
+      const std::vector<std::string> &allowList = std::vector<std::string>(),
+      const std::vector<std::string> &blockList = std::vector<std::string>());
   /// Load the instrument from an open NeXus file.
   void loadInstrumentInfoNexus(const std::string &nxFilename,
                                ::NeXus::File *file, std::string &parameterStr);
@@ -134,7 +137,10 @@ public:
                                      std::string &parameterStr);
 
   /// Load the sample and log info from an open NeXus file.
-  void loadSampleAndLogInfoNexus(::NeXus::File *file);
+  void loadSampleAndLogInfoNexus(
+      ::NeXus::File *file,
+      const std::vector<std::string> &allowList = std::vector<std::string>(),
+      const std::vector<std::string> &blockList = std::vector<std::string>());
   /// Populate the parameter map given a string
   void readParameterMap(const std::string &parameterStr);
 
@@ -183,6 +183,10 @@ public:
                          bool keepOpen = false);
   /// Clear the logs
   void clearLogs();
+  /// Whether a log name matches the allow and block lists of patterns
+  static bool isLogSelected(const std::string &name,
+                            const std::vector<std::string> &allowList,
+                            const std::vector<std::string> &blockList);
 
   bool operator==(const LogManager &other) const;
   bool operator!=(const LogManager &other) const;
@@ -95,6 +95,11 @@ public:
   /// Load the run from a NeXus file with a given group name
   void loadNexus(::NeXus::File *file, const std::string &group,
                  bool keepOpen = false) override;
+  /// Load the run from a NeXus file, with only the selected logs
+  void loadNexus(::NeXus::File *file, const std::string &group,
+                 const std::vector<std::string> &allowList,
+                 const std::vector<std::string> &blockList,
+                 bool keepOpen = false);
 
 private:
   /// Calculate the gonoimeter matrix
@@ -1184,19 +1184,24 @@ void ExperimentInfo::saveExperimentInfoNexus(::NeXus::File *file,
 
 /** Load the sample and log info from an open NeXus file.
  * @param file :: open NeXus file
+ * @param allowList :: patterns of the names of the logs to load; all of them
+ * if empty
+ * @param blockList :: patterns of the names of the logs not to load
  */
-void ExperimentInfo::loadSampleAndLogInfoNexus(::NeXus::File *file) {
+void ExperimentInfo::loadSampleAndLogInfoNexus(
+    ::NeXus::File *file, const std::vector<std::string> &allowList,
+    const std::vector<std::string> &blockList) {
   // First, the sample and then the logs
   int sampleVersion = mutableSample().loadNexus(file, "sample");
   if (sampleVersion == 0) {
     // Old-style (before Sep-9-2011) NXS processed
     // sample field contains both the logs and the sample details
     file->openGroup("sample", "NXsample");
-    this->mutableRun().loadNexus(file, "");
+    this->mutableRun().loadNexus(file, "", allowList, blockList);
     file->closeGroup();
   } else {
     // Newer style: separate "logs" field for the Run object
-    this->mutableRun().loadNexus(file, "logs");
+    this->mutableRun().loadNexus(file, "logs", allowList, blockList);
   }
 }
 
@@ -1206,15 +1211,19 @@ void ExperimentInfo::loadSampleAndLogInfoNexus(::NeXus::File *file) {
  * @param[out] parameterStr :: special string for all the parameters.
  *             Feed that to ExperimentInfo::readParameterMap() after the
  * instrument is done.
+ * @param allowList :: patterns of the names of the logs to load; all of them
+ * if empty
+ * @param blockList :: patterns of the names of the logs not to load
  * @throws Exception::NotFoundError If instrument definition is not in the nexus
  * file and cannot
  *                                  be loaded from the IDF.
  */
-void ExperimentInfo::loadExperimentInfoNexus(const std::string &nxFilename,
-                                             ::NeXus::File *file,
-                                             std::string &parameterStr) {
+void ExperimentInfo::loadExperimentInfoNexus(
+    const std::string &nxFilename, ::NeXus::File *file,
+    std::string &parameterStr, const std::vector<std::string> &allowList,
+    const std::vector<std::string> &blockList) {
   // load sample and log info
-  loadSampleAndLogInfoNexus(file);
+  loadSampleAndLogInfoNexus(file, allowList, blockList);
 
   loadInstrumentInfoNexus(nxFilename, file, parameterStr);
 }
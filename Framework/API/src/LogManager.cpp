@@ -10,8 +10,11 @@
 #include "MantidKernel/PropertyNexus.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
+#include <Poco/Glob.h>
 #include <nexus/NeXusFile.hpp>
 
+#include <algorithm>
+
 namespace Mantid {
 namespace API {
 
@@ -553,6 +556,30 @@ void LogManager::loadNexus(::NeXus::File *file,
  */
 void LogManager::clearLogs() { m_manager->clear(); }
 
+/**
+ * Whether a log is selected by lists of name patterns, which may contain the
+ * wildcards * and ?. The proton charge logs and period_log are always
+ * selected, as normalisation and the event loaders rely on them.
+ * @param name :: The name of the log
+ * @param allowList :: If not empty, the log must match one of these patterns
+ * @param blockList :: The log must not match any of these patterns
+ * @return True if the log is selected
+ */
+bool LogManager::isLogSelected(const std::string &name,
+                               const std::vector<std::string> &allowList,
+                               const std::vector<std::string> &blockList) {
+  if (name == PROTON_CHARGE_LOG_NAME || name == "proton_charge" ||
+      name == "period_log")
+    return true;
+  const auto matches = [&name](const std::string &pattern) {
+    return Poco::Glob(pattern).match(name);
+  };
+  if (!allowList.empty() &&
+      std::none_of(allowList.cbegin(), allowList.cend(), matches))
+    return false;
+  return std::none_of(blockList.cbegin(), blockList.cend(), matches);
+}
+
 bool LogManager::operator==(const LogManager &other) const {
   return *m_manager == *(other.m_manager);
 }
@@ -409,13 +409,40 @@ void Run::saveNexus(::NeXus::File *file, const std::string &group,
  */
 void Run::loadNexus(::NeXus::File *file, const std::string &group,
                     bool keepOpen) {
+  loadNexus(file, group, std::vector<std::string>(),
+            std::vector<std::string>(), keepOpen);
+}
+
+/** Load the object from an open NeXus file, skipping the logs that are not
+ * selected.
+ * @param file :: open NeXus file
+ * @param group :: name of the group to open. Empty string to NOT open a group,
+ * but
+ * load any NXlog in the current open group.
+ * @param allowList :: patterns of the names of the logs to load; all of them
+ * if empty
+ * @param blockList :: patterns of the names of the logs not to load
+ * @param keepOpen :: If true, then the file is left open after doing to load
+ */
+void Run::loadNexus(::NeXus::File *file, const std::string &group,
+                    const std::vector<std::string> &allowList,
+                    const std::vector<std::string> &blockList, bool keepOpen) {
 
   if (!group.empty()) {
     file->openGroup(group, "NXgroup");
   }
   std::map<std::string, std::string> entries;
   file->getEntries(entries);
-  LogManager::loadNexus(file, entries);
+  if (allowList.empty() && blockList.empty()) {
+    LogManager::loadNexus(file, entries);
+  } else {
+    std::map<std::string, std::string> logEntries;
+    for (const auto &entry : entries) {
+      if (isLogSelected(entry.first, allowList, blockList))
+        logEntries.insert(entry);
+    }
+    LogManager::loadNexus(file, logEntries);
+  }
   for (const auto &name_class : entries) {
     if (name_class.second == "NXpositioner") {
       // Goniometer class
@@ -579,6 +579,26 @@ public:
     TS_ASSERT(!(a == b));
   }
 
+  void test_isLogSelected_matches_wildcards() {
+    const std::vector<std::string> none;
+    const std::vector<std::string> allow{"Phase*", "Speed?"};
+    const std::vector<std::string> block{"Phase1"};
+    TS_ASSERT(LogManager::isLogSelected("any_log", none, none));
+    TS_ASSERT(LogManager::isLogSelected("PhaseRequest1", allow, block));
+    TS_ASSERT(LogManager::isLogSelected("Speed3", allow, block));
+    TS_ASSERT(!LogManager::isLogSelected("Speed10", allow, block));
+    TS_ASSERT(!LogManager::isLogSelected("Phase1", allow, block));
+    TS_ASSERT(!LogManager::isLogSelected("Phase1", none, block));
+  }
+
+  void test_isLogSelected_keeps_charge_and_period_logs() {
+    const std::vector<std::string> allow{"Phase*"};
+    const std::vector<std::string> block{"*"};
+    for (const auto name : {"gd_prtn_chrg", "proton_charge", "period_log"}) {
+      TS_ASSERT(LogManager::isLogSelected(name, allow, block));
+    }
+  }
+
 private:
   template <typename T>
   void doTest_GetPropertyAsSingleValue_SingleType(const T value) {
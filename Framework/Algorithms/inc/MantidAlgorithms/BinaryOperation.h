@@ -96,8 +96,8 @@ protected:
   virtual bool propagateSpectraMask(const API::SpectrumInfo &lhsSpectrumInfo,
                                     const API::SpectrumInfo &rhsSpectrumInfo,
                                     const int64_t index,
-                                    API::MatrixWorkspace &out,
-                                    API::SpectrumInfo &outSpectrumInfo);
+                                    API::MatrixWorkspace &out);
+  void applySpectraMasks();
 
   /** Carries out the binary operation on a single spectrum, with another
    *spectrum as the right-hand operand.
@@ -221,6 +221,8 @@ protected:
   size_t m_lhsBlocksize;
   /// Cache for RHS workspace's blocksize
   size_t m_rhsBlocksize;
+  /// Output spectra to mask once the operation is done
+  std::vector<char> m_spectraToMask;
 
   //------ Requirements -----------
 
@@ -0,0 +1,64 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAlgorithms/DllConfig.h"
+
+namespace Mantid {
+namespace HistogramData {
+class Histogram;
+class HistogramE;
+class HistogramY;
+} // namespace HistogramData
+namespace Algorithms {
+namespace BinaryOperationKernels {
+/**
+  Element-wise kernels computing the values and the errors of the Plus, Minus,
+  Multiply and Divide operations on a histogram, with either a histogram or a
+  single value with its error on the right-hand side.
+
+  Each kernel is a single loop over the contiguous Y and E data, in which every
+  bin only depends on the inputs of the same bin, so that the compiler can
+  vectorise it. The outputs may be the Y and E of one of the inputs.
+*/
+
+MANTID_ALGORITHMS_DLL void plus(const HistogramData::Histogram &lhs,
+                                const HistogramData::Histogram &rhs,
+                                HistogramData::HistogramY &YOut,
+                                HistogramData::HistogramE &EOut);
+MANTID_ALGORITHMS_DLL void plus(const HistogramData::Histogram &lhs,
+                                const double rhsY, const double rhsE,
+                                HistogramData::HistogramY &YOut,
+                                HistogramData::HistogramE &EOut);
+MANTID_ALGORITHMS_DLL void minus(const HistogramData::Histogram &lhs,
+                                 const HistogramData::Histogram &rhs,
+                                 HistogramData::HistogramY &YOut,
+                                 HistogramData::HistogramE &EOut);
+MANTID_ALGORITHMS_DLL void minus(const HistogramData::Histogram &lhs,
+                                 const double rhsY, const double rhsE,
+                                 HistogramData::HistogramY &YOut,
+                                 HistogramData::HistogramE &EOut);
+MANTID_ALGORITHMS_DLL void multiply(const HistogramData::Histogram &lhs,
+                                    const HistogramData::Histogram &rhs,
+                                    HistogramData::HistogramY &YOut,
+                                    HistogramData::HistogramE &EOut);
+MANTID_ALGORITHMS_DLL void multiply(const HistogramData::Histogram &lhs,
+                                    const double rhsY, const double rhsE,
+                                    HistogramData::HistogramY &YOut,
+                                    HistogramData::HistogramE &EOut);
+MANTID_ALGORITHMS_DLL void divide(const HistogramData::Histogram &lhs,
+                                  const HistogramData::Histogram &rhs,
+                                  HistogramData::HistogramY &YOut,
+                                  HistogramData::HistogramE &EOut);
+MANTID_ALGORITHMS_DLL void divide(const HistogramData::Histogram &lhs,
+                                  const double rhsY, const double rhsE,
+                                  HistogramData::HistogramY &YOut,
+                                  HistogramData::HistogramE &EOut);
+
+} // namespace BinaryOperationKernels
+} // namespace Algorithms
+} // namespace Mantid
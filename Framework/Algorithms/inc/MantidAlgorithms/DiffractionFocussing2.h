@@ -13,6 +13,9 @@
 #include "MantidIndexing/SpectrumNumber.h"
 
 namespace Mantid {
+namespace API {
+class Progress;
+}
 namespace Algorithms {
 /**
  Algorithm to focus powder diffraction data into a number of histograms
@@ -92,6 +95,11 @@ private:
 
   // For events
   void execEvent();
+  template <class T>
+  void scatterEvents(DataObjects::EventWorkspace &out,
+                     const std::vector<std::size_t> &groupSizes,
+                     const std::vector<std::size_t> &offsets,
+                     const bool inPlace, API::Progress &prog);
 
   /// Loop over the workspace and determine the rebin parameters
   /// (Xmin,Xmax,step) for each group.
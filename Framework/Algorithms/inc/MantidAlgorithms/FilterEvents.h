@@ -111,6 +111,9 @@ private:
   /// Filter events by splitters in format of vector
   void filterEventsByVectorSplitters(double progressamount);
 
+  /// Output event lists of a spectrum, indexed by target workspace index + 1
+  std::vector<DataObjects::EventList *> getOutputEventLists(size_t wsindex);
+
   /// Examine workspace
   void examineAndSortEventWS();
 
@@ -230,6 +233,8 @@ private:
   Types::Core::DateAndTime m_filterStartTime;
   // EventWorkspace (aka. run)'s starting time
   Types::Core::DateAndTime m_runStartTime;
+  /// Flag to let the outputs copy their events from the input when needed
+  bool m_copyEventsOnDemand;
 };
 
 } // namespace Algorithms
@@ -435,20 +435,19 @@ std::string BinaryOperation::checkSizeCompatibility(
 /**
  * Checks if the spectra at the given index of either input workspace is masked.
  * If so then the output spectra has zeroed data
- * and is also masked.
+ * and is recorded to be masked by applySpectraMasks once all spectra are done.
+ * This may be called in parallel for different indices.
  * @param lhsSpectrumInfo :: The LHS spectrum info object
  * @param rhsSpectrumInfo :: The RHS spectrum info object
  * @param index :: The workspace index to check
  * @param out :: A pointer to the output workspace
- * @param outSpectrumInfo :: The spectrum info object of `out`
  * @returns True if further processing is not required on the spectra, false if
  * the binary operation should be performed.
  */
 bool BinaryOperation::propagateSpectraMask(const SpectrumInfo &lhsSpectrumInfo,
                                            const SpectrumInfo &rhsSpectrumInfo,
                                            const int64_t index,
-                                           MatrixWorkspace &out,
-                                           SpectrumInfo &outSpectrumInfo) {
+                                           MatrixWorkspace &out) {
   bool continueOp(true);
 
   if ((lhsSpectrumInfo.hasDetectors(index) &&
@@ -457,11 +456,29 @@ bool BinaryOperation::propagateSpectraMask(const SpectrumInfo &lhsSpectrumInfo,
        rhsSpectrumInfo.isMasked(index))) {
     continueOp = false;
     out.getSpectrum(index).clearData();
-    PARALLEL_CRITICAL(setMasked) { outSpectrumInfo.setMasked(index, true); }
+    m_spectraToMask[index] = 1;
   }
   return continueOp;
 }
 
+/**
+ * Masks the spectra of the output recorded by propagateSpectraMask. Setting
+ * masks is not thread safe, so this is done in one go after the parallel loop.
+ */
+void BinaryOperation::applySpectraMasks() {
+  if (std::none_of(m_spectraToMask.cbegin(), m_spectraToMask.cend(),
+                   [](const char mask) { return mask != 0; })) {
+    m_spectraToMask.clear();
+    return;
+  }
+  auto &outSpectrumInfo = m_out->mutableSpectrumInfo();
+  for (size_t i = 0; i < m_spectraToMask.size(); ++i) {
+    if (m_spectraToMask[i] != 0)
+      outSpectrumInfo.setMasked(i, true);
+  }
+  m_spectraToMask.clear();
+}
+
 /**
  * Called when the rhs operand is a single value.
  *  Loops over the lhs workspace calling the abstract binary operation function
@@ -522,9 +539,9 @@ void BinaryOperation::doSingleColumn() {
   // value from each m_rhs 'spectrum'
   // and then calling the virtual function
   const int64_t numHists = m_lhs->getNumberHistograms();
-  auto &outSpectrumInfo = m_out->mutableSpectrumInfo();
   auto &lhsSpectrumInfo = m_lhs->spectrumInfo();
   auto &rhsSpectrumInfo = m_rhs->spectrumInfo();
+  m_spectraToMask.assign(numHists, 0);
   if (m_eout) {
     // ---- The output is an EventWorkspace ------
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
@@ -532,8 +549,7 @@ void BinaryOperation::doSingleColumn() {
       PARALLEL_START_INTERUPT_REGION
       const double rhsY = m_rhs->y(i)[0];
       const double rhsE = m_rhs->e(i)[0];
-      if (propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out,
-                               outSpectrumInfo)) {
+      if (propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out)) {
         performEventBinaryOperation(m_eout->getSpectrum(i), rhsY, rhsE);
       }
       m_progress->report(this->name());
@@ -549,8 +565,7 @@ void BinaryOperation::doSingleColumn() {
       const double rhsE = m_rhs->e(i)[0];
 
       m_out->setSharedX(i, m_lhs->sharedX(i));
-      if (propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out,
-                               outSpectrumInfo)) {
+      if (propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out)) {
         // Get reference to output vectors here to break any sharing outside the
         // function call below
         // where the order of argument evaluation is not guaranteed (if it's
@@ -564,6 +579,7 @@ void BinaryOperation::doSingleColumn() {
     }
     PARALLEL_CHECK_INTERUPT_REGION
   }
+  applySpectraMasks();
 }
 
 /** Called when the m_rhs operand is a single spectrum.
@@ -666,9 +682,9 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
   // TODO: Check if this works for event workspaces...
   propagateBinMasks(m_rhs, m_out);
 
-  auto &outSpectrumInfo = m_out->mutableSpectrumInfo();
   auto &lhsSpectrumInfo = m_lhs->spectrumInfo();
   auto &rhsSpectrumInfo = m_rhs->spectrumInfo();
+  m_spectraToMask.assign(m_lhs->getNumberHistograms(), 0);
 
   if (m_eout) {
     // ----------- The output is an EventWorkspace -------------
@@ -689,8 +705,8 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
             continue;
         } else {
           // Check for masking except when mismatched sizes
-          if (!propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out,
-                                    outSpectrumInfo))
+          if (!propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i,
+                                    *m_out))
             continue;
         }
         // Reach here? Do the division
@@ -722,8 +738,8 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
             continue;
         } else {
           // Check for masking except when mismatched sizes
-          if (!propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out,
-                                    outSpectrumInfo))
+          if (!propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i,
+                                    *m_out))
             continue;
         }
 
@@ -761,8 +777,7 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
           continue;
       } else {
         // Check for masking except when mismatched sizes
-        if (!propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out,
-                                  outSpectrumInfo))
+        if (!propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i, *m_out))
           continue;
       }
       // Reach here? Do the division
@@ -783,6 +798,7 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
     }
     PARALLEL_CHECK_INTERUPT_REGION
   }
+  applySpectraMasks();
   // Make sure we don't use outdated MRU
   if (m_ClearRHSWorkspace)
     m_erhs->clearMRU();
@@ -0,0 +1,195 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/BinaryOperationKernels.h"
+#include "MantidHistogramData/Histogram.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <cmath>
+#include <cstdint>
+
+using Mantid::HistogramData::Histogram;
+using Mantid::HistogramData::HistogramE;
+using Mantid::HistogramData::HistogramY;
+
+namespace Mantid {
+namespace Algorithms {
+namespace BinaryOperationKernels {
+
+namespace {
+/// Returns a pointer to the data of an output, which is null if it is empty
+template <class T> double *outputData(T &output) {
+  return output.empty() ? nullptr : &output[0];
+}
+} // namespace
+
+// The kernels read all the inputs of a bin before writing its outputs, so that
+// the outputs may share the storage of the inputs. They are built with
+// -fno-math-errno where it is supported: std::sqrt is only called on sums of
+// squares, which are never negative, and it allows the loops to be vectorised.
+
+void plus(const Histogram &lhs, const Histogram &rhs, HistogramY &YOut,
+          HistogramE &EOut) {
+  const double *lhsY = lhs.y().rawData().data();
+  const double *lhsE = lhs.e().rawData().data();
+  const double *rhsY = rhs.y().rawData().data();
+  const double *rhsE = rhs.e().rawData().data();
+  double *outY = outputData(YOut);
+  double *outE = outputData(EOut);
+  const int64_t bins = static_cast<int64_t>(YOut.size());
+  PRAGMA_OMP(simd)
+  for (int64_t j = 0; j < bins; ++j) {
+    const double leftE = lhsE[j];
+    const double rightE = rhsE[j];
+    outY[j] = lhsY[j] + rhsY[j];
+    outE[j] = std::sqrt(leftE * leftE + rightE * rightE);
+  }
+}
+
+void plus(const Histogram &lhs, const double rhsY, const double rhsE,
+          HistogramY &YOut, HistogramE &EOut) {
+  const double *lhsY = lhs.y().rawData().data();
+  const double *lhsE = lhs.e().rawData().data();
+  double *outY = outputData(YOut);
+  double *outE = outputData(EOut);
+  const int64_t bins = static_cast<int64_t>(YOut.size());
+  // Only do E if non-zero, otherwise just copy
+  if (rhsE != 0.) {
+    const double rhsE2 = rhsE * rhsE;
+    PRAGMA_OMP(simd)
+    for (int64_t j = 0; j < bins; ++j) {
+      const double leftE = lhsE[j];
+      outY[j] = lhsY[j] + rhsY;
+      outE[j] = std::sqrt(leftE * leftE + rhsE2);
+    }
+  } else {
+    PRAGMA_OMP(simd)
+    for (int64_t j = 0; j < bins; ++j) {
+      outY[j] = lhsY[j] + rhsY;
+      outE[j] = lhsE[j];
+    }
+  }
+}
+
+void minus(const Histogram &lhs, const Histogram &rhs, HistogramY &YOut,
+           HistogramE &EOut) {
+  const double *lhsY = lhs.y().rawData().data();
+  const double *lhsE = lhs.e().rawData().data();
+  const double *rhsY = rhs.y().rawData().data();
+  const double *rhsE = rhs.e().rawData().data();
+  double *outY = outputData(YOut);
+  double *outE = outputData(EOut);
+  const int64_t bins = static_cast<int64_t>(YOut.size());
+  PRAGMA_OMP(simd)
+  for (int64_t j = 0; j < bins; ++j) {
+    const double leftE = lhsE[j];
+    const double rightE = rhsE[j];
+    outY[j] = lhsY[j] - rhsY[j];
+    outE[j] = std::sqrt(leftE * leftE + rightE * rightE);
+  }
+}
+
+void minus(const Histogram &lhs, const double rhsY, const double rhsE,
+           HistogramY &YOut, HistogramE &EOut) {
+  // The errors add in the same way as for a sum
+  plus(lhs, -rhsY, rhsE, YOut, EOut);
+}
+
+void multiply(const Histogram &lhs, const Histogram &rhs, HistogramY &YOut,
+              HistogramE &EOut) {
+  const double *lhsY = lhs.y().rawData().data();
+  const double *lhsE = lhs.e().rawData().data();
+  const double *rhsY = rhs.y().rawData().data();
+  const double *rhsE = rhs.e().rawData().data();
+  double *outY = outputData(YOut);
+  double *outE = outputData(EOut);
+  const int64_t bins = static_cast<int64_t>(YOut.size());
+  PRAGMA_OMP(simd)
+  for (int64_t j = 0; j < bins; ++j) {
+    const double leftY = lhsY[j];
+    const double rightY = rhsY[j];
+    // error multiplying two uncorrelated numbers, re-arrange so that you don't
+    // get infinity if leftY or rightY == 0
+    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
+    // (Sc)2 = (Sa c/a)2 + (Sb c/b)2
+    //       = (Sa b)2 + (Sb a)2
+    const double leftTerm = lhsE[j] * rightY;
+    const double rightTerm = rhsE[j] * leftY;
+    outE[j] = std::sqrt(leftTerm * leftTerm + rightTerm * rightTerm);
+    outY[j] = leftY * rightY;
+  }
+}
+
+void multiply(const Histogram &lhs, const double rhsY, const double rhsE,
+              HistogramY &YOut, HistogramE &EOut) {
+  const double *lhsY = lhs.y().rawData().data();
+  const double *lhsE = lhs.e().rawData().data();
+  double *outY = outputData(YOut);
+  double *outE = outputData(EOut);
+  const int64_t bins = static_cast<int64_t>(YOut.size());
+  PRAGMA_OMP(simd)
+  for (int64_t j = 0; j < bins; ++j) {
+    const double leftY = lhsY[j];
+    // see the comment in the function above for the error formula
+    const double leftTerm = lhsE[j] * rhsY;
+    const double rightTerm = rhsE * leftY;
+    outE[j] = std::sqrt(leftTerm * leftTerm + rightTerm * rightTerm);
+    outY[j] = leftY * rhsY;
+  }
+}
+
+void divide(const Histogram &lhs, const Histogram &rhs, HistogramY &YOut,
+            HistogramE &EOut) {
+  const double *lhsY = lhs.y().rawData().data();
+  const double *lhsE = lhs.e().rawData().data();
+  const double *rhsY = rhs.y().rawData().data();
+  const double *rhsE = rhs.e().rawData().data();
+  double *outY = outputData(YOut);
+  double *outE = outputData(EOut);
+  const int64_t bins = static_cast<int64_t>(YOut.size());
+  PRAGMA_OMP(simd)
+  for (int64_t j = 0; j < bins; ++j) {
+    const double leftY = lhsY[j];
+    const double rightY = rhsY[j];
+    //  error dividing two uncorrelated numbers, re-arrange so that you don't
+    //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
+    //  both be infinity)
+    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
+    // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
+    // = (Sa 1/b)2 + (Sb (a/b2))2
+    // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
+    const double leftE = lhsE[j];
+    const double rightTerm = leftY * rhsE[j] / rightY;
+    outE[j] = std::sqrt(leftE * leftE + rightTerm * rightTerm) /
+              std::fabs(rightY);
+    outY[j] = leftY / rightY;
+  }
+}
+
+void divide(const Histogram &lhs, const double rhsY, const double rhsE,
+            HistogramY &YOut, HistogramE &EOut) {
+  const double *lhsY = lhs.y().rawData().data();
+  const double *lhsE = lhs.e().rawData().data();
+  double *outY = outputData(YOut);
+  double *outE = outputData(EOut);
+  const int64_t bins = static_cast<int64_t>(YOut.size());
+  // Do the right-hand part of the error calculation just once
+  const double rhsRatio = rhsE / rhsY;
+  const double rhsFactor = rhsRatio * rhsRatio;
+  const double absRhsY = std::fabs(rhsY);
+  PRAGMA_OMP(simd)
+  for (int64_t j = 0; j < bins; ++j) {
+    const double leftY = lhsY[j];
+    const double leftE = lhsE[j];
+    // see the comment in the function above for the error formula
+    outE[j] = std::sqrt(leftE * leftE + leftY * leftY * rhsFactor) / absRhsY;
+    outY[j] = leftY / rhsY;
+  }
+}
+
+} // namespace BinaryOperationKernels
+} // namespace Algorithms
+} // namespace Mantid
@@ -329,6 +329,68 @@ void DiffractionFocussing2::exec() {
   this->cleanup();
 }
 
+//=============================================================================
+/** Copy the events of the input spectra into the lists of their groups, sized
+ * beforehand to hold all the events of the group. Each input spectrum is
+ * copied at its own offset in the list of its group, so the spectra are
+ * copied in parallel without locks.
+ *
+ * @param out :: the output workspace, with a list of type T for each group
+ * @param groupSizes :: the number of events of each group
+ * @param offsets :: offset of the events of each input spectrum in its group
+ * @param inPlace :: if true, each input spectrum is cleared once copied, to
+ * release its memory as soon as possible
+ * @param prog :: reports each copied spectrum
+ */
+template <class T>
+void DiffractionFocussing2::scatterEvents(EventWorkspace &out,
+                                          const vector<size_t> &groupSizes,
+                                          const vector<size_t> &offsets,
+                                          const bool inPlace, Progress &prog) {
+  vector<vector<T> *> groupEvents(m_wsIndices.size());
+  vector<std::pair<size_t, size_t>> sources;
+  for (size_t iGroup = 0; iGroup < m_wsIndices.size(); ++iGroup) {
+    getEventsFrom(out.getSpectrum(iGroup), groupEvents[iGroup]);
+    groupEvents[iGroup]->resize(groupSizes[iGroup]);
+    for (const auto wi : m_wsIndices[iGroup])
+      sources.emplace_back(iGroup, wi);
+  }
+
+  auto inputW = std::const_pointer_cast<EventWorkspace>(m_eventW);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW, out))
+  for (int64_t i = 0; i < static_cast<int64_t>(sources.size()); ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto wi = sources[i].second;
+    const auto &inputEL = m_eventW->getSpectrum(wi);
+    const vector<T> *events;
+    getEventsFrom(inputEL, events);
+    std::copy(events->cbegin(), events->cend(),
+              groupEvents[sources[i].first]->begin() + offsets[wi]);
+    // When focussing in place, you can clear out old memory from the input
+    // one! Its detector IDs are still needed below.
+    if (inPlace)
+      inputW->getSpectrum(wi).clear(false);
+    prog.report("Appending Lists");
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW, out))
+  for (int iGroup = 0; iGroup < static_cast<int>(m_wsIndices.size());
+       ++iGroup) {
+    PARALLEL_START_INTERUPT_REGION
+    auto &groupEL = out.getSpectrum(iGroup);
+    for (const auto wi : m_wsIndices[iGroup]) {
+      groupEL.addDetectorIDs(m_eventW->getSpectrum(wi).getDetectorIDs());
+      if (inPlace)
+        inputW->getSpectrum(wi).clearDetectorIDs();
+    }
+    groupEL.setSortOrder(UNSORTED);
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+}
+
 //=============================================================================
 /** Executes the algorithm in the case of an Event input workspace
  *
@@ -353,15 +415,21 @@ void DiffractionFocussing2::execEvent() {
   std::unique_ptr<Progress> prog =
       std::make_unique<Progress>(this, 0.2, 0.25, nGroups);
 
-  // determine precount size
+  // determine precount size, and the offset of the events of each spectrum in
+  // its group
   vector<size_t> size_required(this->m_validGroups.size(), 0);
+  vector<size_t> offsets(m_eventW->getNumberHistograms(), 0);
+  bool sameEventType = true;
   int totalHistProcess = 0;
   for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
     const vector<size_t> &indices = this->m_wsIndices[iGroup];
 
     totalHistProcess += static_cast<int>(indices.size());
     for (auto index : indices) {
-      size_required[iGroup] += m_eventW->getSpectrum(index).getNumberEvents();
+      const EventList &el = m_eventW->getSpectrum(index);
+      offsets[index] = size_required[iGroup];
+      size_required[iGroup] += el.getNumberEvents();
+      sameEventType = sameEventType && el.getEventType() == eventWtype;
     }
     prog->report(1, "Pre-counting");
   }
@@ -370,12 +438,14 @@ void DiffractionFocussing2::execEvent() {
   prog.reset();
   prog = std::make_unique<Progress>(this, 0.25, 0.3, totalHistProcess);
 
-  // This creates and reserves the space required
+  // This creates the lists, and reserves the space required if the events
+  // are appended
   for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
     const auto group = static_cast<int>(m_validGroups[iGroup]);
     EventList &groupEL = out->getSpectrum(iGroup);
     groupEL.switchTo(eventWtype);
-    groupEL.reserve(size_required[iGroup]);
+    if (!sameEventType)
+      groupEL.reserve(size_required[iGroup]);
     groupEL.clearDetectorIDs();
     groupEL.setSpectrumNo(group);
     prog->reportIncrement(1, "Allocating");
@@ -385,7 +455,25 @@ void DiffractionFocussing2::execEvent() {
   prog.reset();
   prog = std::make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
 
-  if (this->m_validGroups.size() == 1) {
+  if (sameEventType) {
+    // All the events have the type of the output, so they are copied straight
+    // to their place in the lists of the groups
+    g_log.information() << "Performing focussing by copying events\n";
+    switch (eventWtype) {
+    case TOF:
+      scatterEvents<Types::Event::TofEvent>(*out, size_required, offsets,
+                                            inPlace, *prog);
+      break;
+    case WEIGHTED:
+      scatterEvents<WeightedEvent>(*out, size_required, offsets, inPlace,
+                                   *prog);
+      break;
+    case WEIGHTED_NOTIME:
+      scatterEvents<WeightedEventNoTime>(*out, size_required, offsets, inPlace,
+                                         *prog);
+      break;
+    }
+  } else if (this->m_validGroups.size() == 1) {
     g_log.information() << "Performing focussing on a single group\n";
     // Special case of a single group - parallelize differently
     EventList &groupEL = out->getSpectrum(0);
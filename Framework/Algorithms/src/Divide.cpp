@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/Divide.h"
+#include "MantidAlgorithms/BinaryOperationKernels.h"
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -33,27 +34,7 @@ void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
                                     const HistogramData::Histogram &rhs,
                                     HistogramData::HistogramY &YOut,
                                     HistogramData::HistogramE &EOut) {
-  const auto bins = static_cast<int>(lhs.e().size());
-
-  for (int j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhs.y()[j];
-    const double rightY = rhs.y()[j];
-
-    //  error dividing two uncorrelated numbers, re-arrange so that you don't
-    //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
-    //  both be infinity)
-    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
-    // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
-    // = (Sa 1/b)2 + (Sb (a/b2))2
-    // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
-    EOut[j] = sqrt(pow(lhs.e()[j], 2) + pow(leftY * rhs.e()[j] / rightY, 2)) /
-              fabs(rightY);
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY / rightY;
-  }
+  BinaryOperationKernels::divide(lhs, rhs, YOut, EOut);
 }
 
 void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
@@ -65,19 +46,7 @@ void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
                        "with value zero."
                     << "\n";
 
-  // Do the right-hand part of the error calculation just once
-  const double rhsFactor = pow(rhsE / rhsY, 2);
-  const auto bins = static_cast<int>(lhs.e().size());
-  for (int j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhs.y()[j];
-
-    // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhs.e()[j], 2) + pow(leftY, 2) * rhsFactor) / fabs(rhsY);
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY / rhsY;
-  }
+  BinaryOperationKernels::divide(lhs, rhsY, rhsE, YOut, EOut);
 }
 
 void Divide::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
@@ -70,7 +70,7 @@ FilterEvents::FilterEvents()
       m_vecSplitterTime(), m_vecSplitterGroup(), m_splitSampleLogs(false),
       m_useDBSpectrum(false), m_dbWSIndex(-1), m_tofCorrType(NoneCorrect),
       m_specSkipType(), m_vecSkip(), m_isSplittersRelativeTime(false),
-      m_filterStartTime(0), m_runStartTime(0) {}
+      m_filterStartTime(0), m_runStartTime(0), m_copyEventsOnDemand(false) {}
 
 /** Declare Inputs
  */
@@ -186,6 +186,14 @@ void FilterEvents::init() {
   declareProperty("DescriptiveOutputNames", false,
                   "If selected, the names of the output workspaces will "
                   "include information about each slice.");
+
+  declareProperty("CopyEventsOnDemand", false,
+                  "If selected, the outputs of each spectrum refer to the "
+                  "events of the input spectrum instead of copying them, and "
+                  "each output only copies its own events when they are "
+                  "modified. This is much faster when there are many target "
+                  "workspaces, and saves memory if only some of them are "
+                  "modified.");
 }
 
 std::map<std::string, std::string> FilterEvents::validateInputs() {
@@ -441,6 +449,7 @@ void FilterEvents::processAlgorithmProperties() {
 
   m_outputWSNameBase = this->getPropertyValue("OutputWorkspaceBaseName");
   m_filterByPulseTime = this->getProperty("FilterByPulseTime");
+  m_copyEventsOnDemand = this->getProperty("CopyEventsOnDemand");
 
   m_toGroupWS = this->getProperty("GroupWorkspaces");
 
@@ -1685,6 +1694,31 @@ void FilterEvents::setupCustomizedTOFCorrection() {
   }
 }
 
+/** Get the event lists of a spectrum in all the output workspaces. They are
+ * indexed by target workspace index + 1, so that the events outside the
+ * splitters (target -1) go to the first one, and all the targets can be
+ * filled in a single pass over the input events.
+ * @param wsindex :: workspace index of the spectrum
+ * @return the output event lists, null for targets without a workspace
+ */
+std::vector<DataObjects::EventList *>
+FilterEvents::getOutputEventLists(size_t wsindex) {
+  std::vector<DataObjects::EventList *> outputs;
+  const int maxTarget = m_outputWorkspacesMap.empty()
+                            ? -1
+                            : m_outputWorkspacesMap.rbegin()->first;
+  outputs.resize(static_cast<size_t>(std::max(maxTarget, -1) + 2), nullptr);
+  PARALLEL_CRITICAL(build_elist) {
+    for (auto &ws : m_outputWorkspacesMap) {
+      if (ws.first < -1)
+        continue;
+      outputs[static_cast<size_t>(ws.first + 1)] =
+          &ws.second->getSpectrum(wsindex);
+    }
+  }
+  return outputs;
+}
+
 /** Main filtering method
  * Structure: per spectrum --> per workspace
  */
@@ -1703,27 +1737,22 @@ void FilterEvents::filterEventsBySplitters(double progressamount) {
 
     // Filter the non-skipped
     if (!m_vecSkip[iws]) {
-      // Get the output event lists (should be empty) to be a map
-      std::map<int, DataObjects::EventList *> outputs;
-      PARALLEL_CRITICAL(build_elist) {
-        for (auto &ws : m_outputWorkspacesMap) {
-          int index = ws.first;
-          auto &output_el = ws.second->getSpectrum(iws);
-          outputs.emplace(index, &output_el);
-        }
-      }
+      // Get the output event lists (should be empty), indexed by target
+      const auto outputs = getOutputEventLists(static_cast<size_t>(iws));
       // Get a holder on input workspace's event list of this spectrum
       const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
 
       // Perform the filtering (using the splitting function and just one
       // output)
       if (m_filterByPulseTime) {
-        input_el.splitByPulseTime(m_splitters, outputs);
+        input_el.splitByPulseTime(m_splitters, outputs, m_copyEventsOnDemand);
       } else if (m_tofCorrType != NoneCorrect) {
         input_el.splitByFullTime(m_splitters, outputs, true,
-                                 m_detTofFactors[iws], m_detTofOffsets[iws]);
+                                 m_detTofFactors[iws], m_detTofOffsets[iws],
+                                 m_copyEventsOnDemand);
       } else {
-        input_el.splitByFullTime(m_splitters, outputs, false, 1.0, 0.0);
+        input_el.splitByFullTime(m_splitters, outputs, false, 1.0, 0.0,
+                                 m_copyEventsOnDemand);
       }
     }
 
@@ -1775,15 +1804,8 @@ void FilterEvents::filterEventsByVectorSplitters(double progressamount) {
 
     // Filter the non-skipped spectrum
     if (!m_vecSkip[iws]) {
-      // Get the output event lists (should be empty) to be a map
-      map<int, DataObjects::EventList *> outputs;
-      PARALLEL_CRITICAL(build_elist) {
-        for (auto &ws : m_outputWorkspacesMap) {
-          int index = ws.first;
-          auto &output_el = ws.second->getSpectrum(iws);
-          outputs.emplace(index, &output_el);
-        }
-      }
+      // Get the output event lists (should be empty), indexed by target
+      const auto outputs = getOutputEventLists(static_cast<size_t>(iws));
 
       // Get a holder on input workspace's event list of this spectrum
       const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
@@ -1798,10 +1820,11 @@ void FilterEvents::filterEventsByVectorSplitters(double progressamount) {
       if (m_tofCorrType != NoneCorrect) {
         logmessage = input_el.splitByFullTimeMatrixSplitter(
             m_vecSplitterTime, m_vecSplitterGroup, outputs, true,
-            m_detTofFactors[iws], m_detTofOffsets[iws]);
+            m_detTofFactors[iws], m_detTofOffsets[iws], m_copyEventsOnDemand);
       } else {
         logmessage = input_el.splitByFullTimeMatrixSplitter(
-            m_vecSplitterTime, m_vecSplitterGroup, outputs, false, 1.0, 0.0);
+            m_vecSplitterTime, m_vecSplitterGroup, outputs, false, 1.0, 0.0,
+            m_copyEventsOnDemand);
       }
 
       if (printdetail)
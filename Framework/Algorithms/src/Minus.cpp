@@ -5,7 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/Minus.h"
-#include "MantidKernel/VectorHelper.h"
+#include "MantidAlgorithms/BinaryOperationKernels.h"
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -21,26 +21,14 @@ void Minus::performBinaryOperation(const HistogramData::Histogram &lhs,
                                    const HistogramData::Histogram &rhs,
                                    HistogramData::HistogramY &YOut,
                                    HistogramData::HistogramE &EOut) {
-  std::transform(lhs.y().begin(), lhs.y().end(), rhs.y().begin(), YOut.begin(),
-                 std::minus<>());
-  std::transform(lhs.e().begin(), lhs.e().end(), rhs.e().begin(), EOut.begin(),
-                 VectorHelper::SumGaussError<double>());
+  BinaryOperationKernels::minus(lhs, rhs, YOut, EOut);
 }
 
 void Minus::performBinaryOperation(const HistogramData::Histogram &lhs,
                                    const double rhsY, const double rhsE,
                                    HistogramData::HistogramY &YOut,
                                    HistogramData::HistogramE &EOut) {
-  using std::placeholders::_1;
-  std::transform(lhs.y().begin(), lhs.y().end(), YOut.begin(),
-                 [rhsY](double l) { return l - rhsY; });
-  // Only do E if non-zero, otherwise just copy
-  if (rhsE != 0) {
-    double rhsE2 = rhsE * rhsE;
-    std::transform(lhs.e().begin(), lhs.e().end(), EOut.begin(),
-                   [rhsE2](double l) { return std::sqrt(l * l + rhsE2); });
-  } else
-    EOut = lhs.e();
+  BinaryOperationKernels::minus(lhs, rhsY, rhsE, YOut, EOut);
 }
 
 // ===================================== EVENT LIST BINARY OPERATIONS
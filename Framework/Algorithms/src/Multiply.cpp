@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/Multiply.h"
+#include "MantidAlgorithms/BinaryOperationKernels.h"
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -20,41 +21,14 @@ void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs,
                                       const HistogramData::Histogram &rhs,
                                       HistogramData::HistogramY &YOut,
                                       HistogramData::HistogramE &EOut) {
-  const size_t bins = lhs.e().size();
-  for (size_t j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhs.y()[j];
-    const double rightY = rhs.y()[j];
-
-    // error multiplying two uncorrelated numbers, re-arrange so that you don't
-    // get infinity if leftY or rightY == 0
-    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
-    // (Sc)2 = (Sa c/a)2 + (Sb c/b)2
-    //       = (Sa b)2 + (Sb a)2
-    EOut[j] = sqrt(pow(lhs.e()[j] * rightY, 2) + pow(rhs.e()[j] * leftY, 2));
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY * rightY;
-  }
+  BinaryOperationKernels::multiply(lhs, rhs, YOut, EOut);
 }
 
 void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs,
                                       const double rhsY, const double rhsE,
                                       HistogramData::HistogramY &YOut,
                                       HistogramData::HistogramE &EOut) {
-  const size_t bins = lhs.e().size();
-  for (size_t j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhs.y()[j];
-
-    // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhs.e()[j] * rhsY, 2) + pow(rhsE * leftY, 2));
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY * rhsY;
-  }
+  BinaryOperationKernels::multiply(lhs, rhsY, rhsE, YOut, EOut);
 }
 
 void Multiply::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
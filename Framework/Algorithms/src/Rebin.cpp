@@ -249,14 +249,27 @@ void Rebin::exec() {
           1, std::unique_ptr<Axis>(inputWS->getAxis(1)->clone(outputWS.get())));
     bool ignoreBinErrors = getProperty("IgnoreBinErrors");
 
+    // Spectra sharing their X with the previous one are rebinned with the
+    // overlaps found for it, kept by each thread
+    std::vector<std::unique_ptr<HistogramData::RebinPlan>> plans(
+        PARALLEL_GET_MAX_THREADS);
     Progress prog(this, 0.0, 1.0, histnumber);
     PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
     for (int hist = 0; hist < histnumber; ++hist) {
       PARALLEL_START_INTERUPT_REGION
 
       try {
-        outputWS->setHistogram(
-            hist, HistogramData::rebin(inputWS->histogram(hist), XValues_new));
+        const auto histogram = inputWS->histogram(hist);
+        auto &plan = plans[PARALLEL_THREAD_NUMBER];
+        if ((!plan || !plan->appliesTo(histogram)) && hist > 0 &&
+            inputWS->sharedX(hist - 1) == histogram.sharedX())
+          plan = std::make_unique<HistogramData::RebinPlan>(histogram,
+                                                            XValues_new);
+        if (plan && plan->appliesTo(histogram))
+          outputWS->setHistogram(hist, HistogramData::rebin(histogram, *plan));
+        else
+          outputWS->setHistogram(hist,
+                                 HistogramData::rebin(histogram, XValues_new));
       } catch (InvalidBinEdgesError &) {
         if (ignoreBinErrors)
           outputWS->setBinEdges(hist, XValues_new);
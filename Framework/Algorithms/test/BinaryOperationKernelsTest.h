@@ -0,0 +1,149 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAlgorithms/BinaryOperationKernels.h"
+#include "MantidHistogramData/Histogram.h"
+#include "MantidHistogramData/LinearGenerator.h"
+
+#include <cmath>
+
+using namespace Mantid::Algorithms;
+using namespace Mantid::HistogramData;
+
+class BinaryOperationKernelsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BinaryOperationKernelsTest *createSuite() {
+    return new BinaryOperationKernelsTest();
+  }
+  static void destroySuite(BinaryOperationKernelsTest *suite) { delete suite; }
+
+  void test_plus() {
+    const auto lhs = makeHistogram({1., 2., 3.}, {3., 4., 0.});
+    const auto rhs = makeHistogram({4., -1., 0.5}, {4., 3., 2.});
+    HistogramY y(3);
+    HistogramE e(3);
+    BinaryOperationKernels::plus(lhs, rhs, y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({5., 1., 3.5}));
+    TS_ASSERT_EQUALS(e.rawData(), std::vector<double>({5., 5., 2.}));
+  }
+
+  void test_plus_value() {
+    const auto lhs = makeHistogram({1., 2.}, {3., 0.});
+    HistogramY y(2);
+    HistogramE e(2);
+    BinaryOperationKernels::plus(lhs, 2., 4., y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({3., 4.}));
+    TS_ASSERT_EQUALS(e.rawData(), std::vector<double>({5., 4.}));
+  }
+
+  void test_plus_value_without_error_copies_the_errors() {
+    const auto lhs = makeHistogram({1., 2.}, {3., 0.5});
+    HistogramY y(2);
+    HistogramE e(2);
+    BinaryOperationKernels::plus(lhs, 2., 0., y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({3., 4.}));
+    TS_ASSERT_EQUALS(e.rawData(), std::vector<double>({3., 0.5}));
+  }
+
+  void test_minus() {
+    const auto lhs = makeHistogram({1., 2.}, {3., 0.});
+    const auto rhs = makeHistogram({4., -1.}, {4., 3.});
+    HistogramY y(2);
+    HistogramE e(2);
+    BinaryOperationKernels::minus(lhs, rhs, y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({-3., 3.}));
+    TS_ASSERT_EQUALS(e.rawData(), std::vector<double>({5., 3.}));
+  }
+
+  void test_minus_value() {
+    const auto lhs = makeHistogram({1., 2.}, {3., 0.});
+    HistogramY y(2);
+    HistogramE e(2);
+    BinaryOperationKernels::minus(lhs, 2., 4., y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({-1., 0.}));
+    TS_ASSERT_EQUALS(e.rawData(), std::vector<double>({5., 4.}));
+  }
+
+  void test_multiply() {
+    const auto lhs = makeHistogram({2., 0.}, {1., 1.});
+    const auto rhs = makeHistogram({3., 4.}, {2., 0.5});
+    HistogramY y(2);
+    HistogramE e(2);
+    BinaryOperationKernels::multiply(lhs, rhs, y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({6., 0.}));
+    TS_ASSERT_EQUALS(e[0], 5.);
+    TS_ASSERT_EQUALS(e[1], 4.);
+  }
+
+  void test_multiply_value() {
+    const auto lhs = makeHistogram({2., 0.}, {1., 1.});
+    HistogramY y(2);
+    HistogramE e(2);
+    BinaryOperationKernels::multiply(lhs, 3., 2., y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({6., 0.}));
+    TS_ASSERT_EQUALS(e.rawData(), std::vector<double>({5., 3.}));
+  }
+
+  void test_divide() {
+    const auto lhs = makeHistogram({6., 0.}, {4., 2.});
+    const auto rhs = makeHistogram({2., 4.}, {1., 1.});
+    HistogramY y(2);
+    HistogramE e(2);
+    BinaryOperationKernels::divide(lhs, rhs, y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({3., 0.}));
+    TS_ASSERT_EQUALS(e[0], 2.5);
+    TS_ASSERT_EQUALS(e[1], 0.5);
+  }
+
+  void test_divide_by_zero_gives_infinity() {
+    const auto lhs = makeHistogram({6.}, {4.});
+    const auto rhs = makeHistogram({0.}, {1.});
+    HistogramY y(1);
+    HistogramE e(1);
+    BinaryOperationKernels::divide(lhs, rhs, y, e);
+    TS_ASSERT(std::isinf(y[0]));
+    TS_ASSERT(std::isinf(e[0]));
+  }
+
+  void test_divide_value() {
+    const auto lhs = makeHistogram({6., 0.}, {4., 2.});
+    HistogramY y(2);
+    HistogramE e(2);
+    BinaryOperationKernels::divide(lhs, 2., 1., y, e);
+    TS_ASSERT_EQUALS(y.rawData(), std::vector<double>({3., 0.}));
+    TS_ASSERT_EQUALS(e.rawData(), std::vector<double>({2.5, 1.}));
+  }
+
+  void test_output_may_be_the_input() {
+    auto lhs = makeHistogram({2., 0.}, {1., 1.});
+    const auto rhs = makeHistogram({3., 4.}, {2., 0.5});
+    BinaryOperationKernels::multiply(lhs, rhs, lhs.mutableY(), lhs.mutableE());
+    TS_ASSERT_EQUALS(lhs.y().rawData(), std::vector<double>({6., 0.}));
+    TS_ASSERT_EQUALS(lhs.e().rawData(), std::vector<double>({5., 4.}));
+  }
+
+  void test_empty_histograms() {
+    const auto lhs = makeHistogram({}, {});
+    HistogramY y(0);
+    HistogramE e(0);
+    TS_ASSERT_THROWS_NOTHING(BinaryOperationKernels::plus(lhs, lhs, y, e));
+    TS_ASSERT_THROWS_NOTHING(
+        BinaryOperationKernels::divide(lhs, 2., 1., y, e));
+  }
+
+private:
+  Histogram makeHistogram(const std::vector<double> &y,
+                          const std::vector<double> &e) {
+    return Histogram(Points(y.size(), LinearGenerator(0., 1.)), Counts(y),
+                     CountStandardDeviations(e));
+  }
+};
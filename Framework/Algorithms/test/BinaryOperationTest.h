@@ -294,6 +294,46 @@ public:
     }
   }
 
+  void testMaskedSpectraOfBothSidesAreMaskedAndZeroedInOutput() {
+    const int nHist = 50, nBins = 10;
+    const std::set<int64_t> lhsMasking{3, 8};
+    const std::set<int64_t> rhsMasking{1, 7, 8, 30, 49};
+    std::set<int64_t> masking(lhsMasking);
+    masking.insert(rhsMasking.cbegin(), rhsMasking.cend());
+
+    MatrixWorkspace_sptr work_in1 =
+        WorkspaceCreationHelper::create2DWorkspace154(nHist, nBins, 0,
+                                                      lhsMasking);
+    MatrixWorkspace_sptr work_in2 =
+        WorkspaceCreationHelper::create2DWorkspace123(nHist, nBins, 0,
+                                                      rhsMasking);
+
+    BinaryOpHelper helper;
+    helper.initialize();
+    helper.setProperty("LHSWorkspace", work_in1);
+    helper.setProperty("RHSWorkspace", work_in2);
+    const std::string outputSpace("test");
+    helper.setPropertyValue("OutputWorkspace", outputSpace);
+    helper.setRethrows(true);
+    helper.execute();
+    TS_ASSERT(helper.isExecuted());
+
+    MatrixWorkspace_sptr output =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+            outputSpace);
+    TS_ASSERT(output);
+    const auto &spectrumInfo = output->spectrumInfo();
+    for (int i = 0; i < nHist; ++i) {
+      const bool masked = masking.count(i) != 0;
+      TS_ASSERT_EQUALS(spectrumInfo.isMasked(i), masked);
+      if (masked) {
+        TS_ASSERT_EQUALS(output->y(i)[0], 0.);
+        TS_ASSERT_EQUALS(output->e(i)[0], 0.);
+      }
+    }
+    AnalysisDataService::Instance().remove(outputSpace);
+  }
+
   BinaryOperation::BinaryOperationTable_sptr
   do_test_buildBinaryOperationTable(std::vector<std::vector<int>> lhs,
                                     std::vector<std::vector<int>> rhs,
@@ -101,9 +101,23 @@ public:
     dotestEventWorkspace(false, 1, false);
   }
 
+  void test_EventWorkspace_WeightedEvents() {
+    dotestEventWorkspace(false, 2, true, 16, 3 * 16 * 16);
+  }
+
+  void test_EventWorkspace_MixedEventTypes_oneGroup() {
+    dotestEventWorkspace(false, 1, true, 16, 1);
+  }
+
+  void test_EventWorkspace_MixedEventTypes() {
+    dotestEventWorkspace(false, 2, true, 16, 1);
+  }
+
+  /// The last weightedSpectra spectra of the input hold weighted events
   void dotestEventWorkspace(bool inplace, size_t numgroups,
                             bool preserveEvents = true,
-                            int bankWidthInPixels = 16) {
+                            int bankWidthInPixels = 16,
+                            size_t weightedSpectra = 0) {
     std::string nxsWSname("DiffractionFocussing2Test_ws");
 
     // Create the fake event workspace
@@ -132,6 +146,8 @@ public:
       double x = static_cast<double>(1 + pix);
       inputW->setHistogram(pix, BinEdges{x + 0, x + 1, x + 2, x + 3, 1e6});
       inputW->getSpectrum(pix).addEventQuickly(TofEvent(1000.0));
+      if (pix + weightedSpectra >= inputW->getNumberHistograms())
+        inputW->getSpectrum(pix).switchTo(WEIGHTED);
     }
 
     // ------------ Create a grouping workspace by name -------------
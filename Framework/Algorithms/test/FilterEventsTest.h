@@ -282,6 +282,59 @@ public:
     return;
   }
 
+  //----------------------------------------------------------------------------------------------
+  /** Filter events with the outputs copying their events on demand: they
+   * must end up with the same events as outputs filled straight away
+   */
+  void test_FilterCopyEventsOnDemand() {
+    int64_t runstart_i64 = 20000000000;
+    int64_t pulsedt = 100 * 1000 * 1000;
+    int64_t tofdt = 10 * 1000 * 1000;
+    size_t numpulses = 5;
+
+    EventWorkspace_sptr inpWS =
+        createEventWorkspace(runstart_i64, pulsedt, tofdt, numpulses);
+    AnalysisDataService::Instance().addOrReplace("TestOnDemand", inpWS);
+    SplittersWorkspace_sptr splws =
+        createSplittersWorkspace(runstart_i64, pulsedt, tofdt);
+    AnalysisDataService::Instance().addOrReplace("SplitterOnDemand", splws);
+
+    for (const bool onDemand : {false, true}) {
+      FilterEvents filter;
+      filter.initialize();
+      filter.setProperty("InputWorkspace", "TestOnDemand");
+      filter.setProperty("OutputWorkspaceBaseName",
+                         onDemand ? "OnDemand" : "Copied");
+      filter.setProperty("SplitterWorkspace", "SplitterOnDemand");
+      filter.setProperty("CopyEventsOnDemand", onDemand);
+      TS_ASSERT_THROWS_NOTHING(filter.execute());
+      TS_ASSERT(filter.isExecuted());
+    }
+
+    for (const std::string target : {"_0", "_1", "_2", "_unfiltered"}) {
+      auto copied = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+          "Copied" + target);
+      auto onDemand =
+          AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+              "OnDemand" + target);
+      TS_ASSERT_EQUALS(onDemand->getNumberEvents(),
+                       copied->getNumberEvents());
+      for (size_t i = 0; i < copied->getNumberHistograms(); ++i) {
+        const auto &onDemandEvents = onDemand->getSpectrum(i);
+        TS_ASSERT_EQUALS(onDemandEvents.hasSelection(),
+                         !onDemandEvents.empty());
+        TS_ASSERT_EQUALS(onDemandEvents, copied->getSpectrum(i));
+        // Reading the events does not copy them
+        TS_ASSERT_EQUALS(onDemandEvents.hasSelection(),
+                         !onDemandEvents.empty());
+      }
+      AnalysisDataService::Instance().remove("Copied" + target);
+      AnalysisDataService::Instance().remove("OnDemand" + target);
+    }
+    AnalysisDataService::Instance().remove("TestOnDemand");
+    AnalysisDataService::Instance().remove("SplitterOnDemand");
+  }
+
   //----------------------------------------------------------------------------------------------
   /**  Filter events without any correction and test for user-specified
    *workspace starting value
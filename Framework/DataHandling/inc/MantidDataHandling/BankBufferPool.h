@@ -0,0 +1,74 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataHandling/DllConfig.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** BankBufferPool : the buffers into which LoadBankFromDiskTask reads the
+  events of a bank, until ProcessBankData has put them in the event lists.
+
+  Buffers are given back to the pool when the last task using them drops them,
+  and are reused for the next banks rather than allocated again. Reading the
+  next bank can wait until the buffers in use fit in a memory budget, so that
+  reading runs ahead of processing by a bounded amount of memory. The time
+  spent in each stage is accumulated, to report where loading spent its time.
+*/
+class MANTID_DATAHANDLING_DLL BankBufferPool {
+public:
+  /// Time spent in each stage of loading the banks, in seconds
+  struct Timings {
+    double reading{0.};
+    double waiting{0.};
+    double processing{0.};
+  };
+
+  explicit BankBufferPool(const size_t budget);
+  BankBufferPool(const BankBufferPool &) = delete;
+  BankBufferPool &operator=(const BankBufferPool &) = delete;
+
+  void waitForMemory(const size_t bytes);
+  template <typename T>
+  std::shared_ptr<std::vector<T>> acquire(const size_t size);
+
+  void addReadingTime(const double seconds);
+  void addProcessingTime(const double seconds);
+
+  /// Memory the buffers in use may take before reading waits, in bytes
+  size_t budget() const { return m_budget; }
+  size_t bytesInUse() const;
+  size_t peakBytesInUse() const;
+  Timings timings() const;
+
+private:
+  template <typename T>
+  std::vector<std::unique_ptr<std::vector<T>>> &freeBuffers();
+  template <typename T>
+  void release(std::vector<T> *buffer, const size_t bytes);
+
+  const size_t m_budget;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_released;
+  size_t m_bytesInUse{0};
+  size_t m_peakBytesInUse{0};
+  Timings m_timings;
+  /// Buffers of event IDs that are not in use
+  std::vector<std::unique_ptr<std::vector<uint32_t>>> m_freeIds;
+  /// Buffers of times-of-flight or weights that are not in use
+  std::vector<std::unique_ptr<std::vector<float>>> m_freeFloats;
+};
+
+} // namespace DataHandling
+} // namespace Mantid
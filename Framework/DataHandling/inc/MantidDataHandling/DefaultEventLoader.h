@@ -7,9 +7,13 @@
 #pragma once
 
 #include "MantidAPI/Axis.h"
+#include "MantidDataHandling/BankBufferPool.h"
 #include "MantidDataHandling/DllConfig.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
 
+#include <map>
+#include <mutex>
+
 class BankPulseTimes;
 
 namespace Mantid {
@@ -76,6 +80,13 @@ public:
   /// One entry of pulse times for each preprocessor
   std::vector<std::shared_ptr<BankPulseTimes>> m_bankPulseTimes;
 
+  /// Buffers of the banks read from the file and not processed yet
+  BankBufferPool bufferPool;
+
+  /// Table indexed by the compact events of the banks with these pulse times
+  std::shared_ptr<const std::vector<int64_t>>
+  pulseTable(const BankPulseTimes &pulseTimes);
+
 private:
   DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                      bool haveWeights, bool event_id_is_spec,
@@ -87,6 +98,12 @@ private:
   /// Map detector IDs to event lists.
   template <class T>
   void makeMapToEventLists(std::vector<std::vector<T>> &vectors);
+
+  /// Pulse tables of the compact events, by pulse times of the banks
+  std::map<const BankPulseTimes *, std::shared_ptr<const std::vector<int64_t>>>
+      m_pulseTables;
+  /// Protects m_pulseTables
+  std::mutex m_pulseTablesMutex;
 };
 
 /** Generate a look-up table where the index = the pixel ID of an event
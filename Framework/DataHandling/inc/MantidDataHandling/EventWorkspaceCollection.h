@@ -82,6 +82,9 @@ public:
   Types::Core::DateAndTime getFirstPulseTime() const;
   void setAllX(const HistogramData::BinEdges &x);
   size_t getNumberEvents() const;
+  void packColumns();
+  void packCompactEvents(
+      const std::shared_ptr<const std::vector<int64_t>> &pulseTable);
   void setIndexInfo(const Indexing::IndexInfo &indexInfo);
   void setInstrument(const Geometry::Instrument_const_sptr &inst);
   void
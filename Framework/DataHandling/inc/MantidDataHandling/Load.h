@@ -87,9 +87,13 @@ private:
   /// Load a file to a given workspace name.
   API::Workspace_sptr loadFileToWs(const std::string &fileName,
                                    const std::string &wsName);
-  /// Plus two workspaces together, "in place".
-  API::Workspace_sptr plusWs(API::Workspace_sptr ws1,
-                             const API::Workspace_sptr &ws2);
+  /// Create the algorithm loading a file to a given workspace name.
+  API::IAlgorithm_sptr createLoadAlgorithm(const std::string &fileName,
+                                           const std::string &wsName);
+  /// Create the algorithms adding two workspaces together, "in place".
+  std::vector<API::IAlgorithm_sptr>
+  createPlusAlgorithms(const API::Workspace_sptr &ws1,
+                       const API::Workspace_sptr &ws2);
   /// Manually group workspaces.
   API::WorkspaceGroup_sptr
   groupWsList(const std::vector<API::Workspace_sptr> &wsList);
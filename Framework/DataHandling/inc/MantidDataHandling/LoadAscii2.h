@@ -11,6 +11,7 @@
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidKernel/FileDescriptor.h"
 
+#include <array>
 #include <list>
 
 namespace Mantid {
@@ -54,6 +55,18 @@ public:
   int confidence(Kernel::FileDescriptor &descriptor) const override;
 
 protected:
+  /// A line of the data, split into columns and converted to numbers
+  struct DataLine {
+    enum class Kind { Empty, Comment, Values, Single, BadValue, Invalid };
+    Kind kind = Kind::Empty;
+    /// The number of columns
+    size_t columns = 0;
+    /// The values of the columns, if there are between two and four
+    std::array<double, 4> values;
+    /// The trimmed line, if it is a single value or cannot be read
+    std::string text;
+  };
+
   /// Read the data from the file
   virtual API::Workspace_sptr readData(std::ifstream &file);
   /// Read the data from the file into a table workspace
@@ -73,12 +86,14 @@ protected:
   void fillInputValues(std::vector<double> &values,
                        const std::list<std::string> &columns) const;
   // write the values in the current line to teh end fo teh current spectra
-  void addToCurrentSpectra(std::list<std::string> &columns);
+  void addToCurrentSpectra(const std::array<double, 4> &values);
   // check that the nubmer of columns in the current line match the number found
   // previously
   void checkLineColumns(const size_t &cols) const;
+  /// Split a line into columns and convert them to numbers
+  DataLine convertLine(const char *begin, const char *end) const;
   // interpret a line that has been deemed valid enough to look at.
-  void parseLine(const std::string &line, std::list<std::string> &columns);
+  void parseLine(const DataLine &line);
   // find the number of collums we should expect from now on
   void setcolumns(std::ifstream &file, std::string &line,
                   std::list<std::string> &columns);
@@ -108,6 +123,9 @@ private:
   size_t m_lineNo;
   std::vector<DataObjects::Histogram1D> m_spectra;
   std::unique_ptr<DataObjects::Histogram1D> m_curSpectra;
+  std::vector<double> m_curX;
+  std::vector<double> m_curY;
+  std::vector<double> m_curE;
   std::vector<double> m_curDx;
   std::vector<double> m_spectrumAxis;
 };
@@ -193,9 +193,15 @@ public:
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
 
+  /// Compress the events into bins of width compressTolerance as they are read
+  bool compressWhileReading;
+
   /// Pulse times for ALL banks, taken from proton_charge log.
   std::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
 
+  /// Keep the events in compact storage as they are loaded
+  bool compactEvents;
+
   /// name of top level NXentry to use
   std::string m_top_entry_name;
   std::unique_ptr<::NeXus::File> m_file;
@@ -76,15 +76,16 @@ private:
                 const std::shared_ptr<API::MatrixWorkspace> &workspace) const;
 
   /**
-   * Load an NXlog entry
+   * Open an NXlog entry, if it has time and value entries
    * @param file input Nexus file handler
    * @param absolute_entry_name full entry name in Nexus
    * @param entry_class type of the entry (NXlog)
-   * @param workspace input workspace
    */
-  void loadNXLog(::NeXus::File &file, const std::string &absolute_entry_name,
-                 const std::string &entry_class,
-                 const std::shared_ptr<API::MatrixWorkspace> &workspace) const;
+  bool openNXLog(::NeXus::File &file, const std::string &absolute_entry_name,
+                 const std::string &entry_class) const;
+
+  /// Whether a log is to be loaded, from the allow and block lists
+  bool isLogWanted(const std::string &logName) const;
 
   /**
    * Load an IXseblock entry
@@ -107,6 +108,11 @@ private:
   /// Use frequency start for Monitor19 and Special1_19 logs with "No Time" for
   /// SNAP
   std::string freqStart;
+
+  /// Patterns of the names of the logs to load; all logs if empty
+  std::vector<std::string> m_allowList;
+  /// Patterns of the names of the logs not to load
+  std::vector<std::string> m_blockList;
 };
 
 } // namespace DataHandling
@@ -162,15 +162,6 @@ private:
   void readBinMasking(Mantid::NeXus::NXData &wksp_cls,
                       const API::MatrixWorkspace_sptr &local_workspace);
 
-  /// Load a block of data into the workspace where it is assumed that the x
-  /// bins have already been cached
-  void loadBlock(Mantid::NeXus::NXDataSetTyped<double> &data,
-                 Mantid::NeXus::NXDataSetTyped<double> &errors,
-                 Mantid::NeXus::NXDataSetTyped<double> &farea, bool hasFArea,
-                 Mantid::NeXus::NXDouble &xErrors, bool hasXErrors,
-                 int blocksize, int nchannels, int &hist,
-                 const API::MatrixWorkspace_sptr &local_workspace);
-
   /// Load a block of data into the workspace where it is assumed that the x
   /// bins have already been cached
   void loadBlock(Mantid::NeXus::NXDataSetTyped<double> &data,
@@ -227,8 +218,7 @@ private:
 
   /// The value of the spectrum_list property
   std::vector<int> m_spec_list;
-  /// list of spectra filtered by min/max/list, currently
-  /// used only when loading data into event_workspace
+  /// list of spectra filtered by min/max/list
   std::vector<int> m_filtered_spec_idxs;
 
   // Handle to the NeXus file
@@ -58,6 +58,7 @@ public:
 
 private:
   size_t getWorkspaceIndexFromPixelID(const detid_t pixID);
+  template <class Func> void forEachEventList(const Func &func);
   size_t getFirstEventIndex(const size_t pulseIndex) const;
   size_t getLastEventIndex(const size_t pulseIndex,
                            const size_t numPulses) const;
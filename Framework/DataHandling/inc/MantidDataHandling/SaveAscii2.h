@@ -75,8 +75,8 @@ private:
                            const std::string &filename, bool appendToFile,
                            bool writeHeader, int prec, bool scientific,
                            const std::string &comment);
-  /// Writes a spectrum to the file using a workspace index
-  void writeSpectrum(const int &wsIndex, std::ofstream &file);
+  /// Writes a spectrum to a stream using a workspace index
+  void writeSpectrum(const int &wsIndex, std::ostream &file) const;
   std::vector<std::string> stringListToVector(std::string &inputString);
   void populateQMetaData();
   void populateSpectrumNumberMetaData();
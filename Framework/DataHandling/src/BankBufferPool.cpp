@@ -0,0 +1,126 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/BankBufferPool.h"
+#include "MantidKernel/Timer.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace DataHandling {
+
+template <>
+std::vector<std::unique_ptr<std::vector<uint32_t>>> &
+BankBufferPool::freeBuffers<uint32_t>() {
+  return m_freeIds;
+}
+
+template <>
+std::vector<std::unique_ptr<std::vector<float>>> &
+BankBufferPool::freeBuffers<float>() {
+  return m_freeFloats;
+}
+
+/** Constructor
+ * @param budget :: memory the buffers in use may take before reading waits,
+ * in bytes
+ */
+BankBufferPool::BankBufferPool(const size_t budget) : m_budget(budget) {}
+
+/** Wait until buffers of the given size fit in the budget. Buffers that are
+ * larger than the budget on their own only wait until no buffer is in use.
+ * @param bytes :: size of the buffers that are about to be acquired
+ */
+void BankBufferPool::waitForMemory(const size_t bytes) {
+  Kernel::Timer timer;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_released.wait(lock, [this, bytes] {
+    return m_bytesInUse == 0 || m_bytesInUse + bytes <= m_budget;
+  });
+  m_timings.waiting += timer.elapsed();
+}
+
+/** Get a buffer, reusing one that was released if possible. The buffer goes
+ * back to the pool when the last shared pointer to it is dropped.
+ * @param size :: number of elements of the buffer
+ * @return the buffer, of the given size
+ */
+template <typename T>
+std::shared_ptr<std::vector<T>> BankBufferPool::acquire(const size_t size) {
+  const size_t bytes = size * sizeof(T);
+  std::unique_ptr<std::vector<T>> buffer;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto &buffers = freeBuffers<T>();
+    if (!buffers.empty()) {
+      buffer = std::move(buffers.back());
+      buffers.pop_back();
+    }
+    m_bytesInUse += bytes;
+    m_peakBytesInUse = std::max(m_peakBytesInUse, m_bytesInUse);
+  }
+  if (!buffer)
+    buffer = std::make_unique<std::vector<T>>();
+  buffer->resize(size);
+  return std::shared_ptr<std::vector<T>>(
+      buffer.release(),
+      [this, bytes](std::vector<T> *released) { release(released, bytes); });
+}
+
+/// Put a buffer back into the pool and wake up the reading waiting for memory
+template <typename T>
+void BankBufferPool::release(std::vector<T> *buffer, const size_t bytes) {
+  std::unique_ptr<std::vector<T>> owned(buffer);
+  owned->clear();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bytesInUse -= bytes;
+    try {
+      freeBuffers<T>().emplace_back(std::move(owned));
+    } catch (std::bad_alloc &) {
+      // The buffer is freed rather than pooled
+    }
+  }
+  m_released.notify_all();
+}
+
+/// Add to the time spent reading banks from the file
+void BankBufferPool::addReadingTime(const double seconds) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_timings.reading += seconds;
+}
+
+/// Add to the time spent putting the events read into the event lists
+void BankBufferPool::addProcessingTime(const double seconds) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_timings.processing += seconds;
+}
+
+/// Memory taken by the buffers in use, in bytes
+size_t BankBufferPool::bytesInUse() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_bytesInUse;
+}
+
+/// Most memory taken by the buffers in use at any time, in bytes
+size_t BankBufferPool::peakBytesInUse() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_peakBytesInUse;
+}
+
+/// Time spent in each stage so far
+BankBufferPool::Timings BankBufferPool::timings() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_timings;
+}
+
+template MANTID_DATAHANDLING_DLL std::shared_ptr<std::vector<uint32_t>>
+BankBufferPool::acquire<uint32_t>(const size_t);
+template MANTID_DATAHANDLING_DLL std::shared_ptr<std::vector<float>>
+BankBufferPool::acquire<float>(const size_t);
+
+} // namespace DataHandling
+} // namespace Mantid
@@ -8,14 +8,32 @@
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidKernel/Memory.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
 
+#include <algorithm>
+#include <limits>
+
 using namespace Mantid::Kernel;
 
 namespace Mantid {
 namespace DataHandling {
 
+namespace {
+/// Memory the banks read ahead of their processing may take, in bytes
+size_t readAheadBudget() {
+  // Reading waits for other threads to process the banks read before, so
+  // there is nothing to wait for with a single thread
+  if (ThreadPool::getNumPhysicalCores() < 2)
+    return std::numeric_limits<size_t>::max();
+  // A quarter of the available memory, which keeps a few banks in flight
+  // without competing with the event lists being filled
+  MemoryStats memory;
+  return memory.availMem() * 1024 / 4;
+}
+} // namespace
+
 void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                               bool haveWeights, bool event_id_is_spec,
                               std::vector<std::string> bankNames,
@@ -49,6 +67,14 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
   // Start and end all threads
   pool.joinAll();
   diskIOMutex.reset();
+
+  const auto timings = loader.bufferPool.timings();
+  alg->getLogger().debug()
+      << "Loading banks took " << timings.reading << " s reading, "
+      << timings.waiting << " s waiting for memory and " << timings.processing
+      << " s processing events, with at most "
+      << loader.bufferPool.peakBytesInUse() / (1024 * 1024)
+      << " MB of events read ahead.\n";
 }
 
 DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
@@ -59,7 +85,7 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
                                        const int totalChunks)
     : m_haveWeights(haveWeights), event_id_is_spec(event_id_is_spec),
       precount(precount), chunk(chunk), totalChunks(totalChunks), alg(alg),
-      m_ws(ws) {
+      m_ws(ws), bufferPool(readAheadBudget()) {
   // This map will be used to find the workspace index
   if (event_id_is_spec)
     pixelID_to_wi_vector =
@@ -153,5 +179,28 @@ DefaultEventLoader::setupChunking(std::vector<std::string> &bankNames,
   return {bank0, bankn};
 }
 
+/** Get the table of the pulse times of a bank, to be indexed by its compact
+ * events. The table is built once and shared by all the banks with the same
+ * pulse times.
+ * @param pulseTimes :: the pulse times of the bank
+ * @return the sorted, unique pulse times in nanoseconds
+ */
+std::shared_ptr<const std::vector<int64_t>>
+DefaultEventLoader::pulseTable(const BankPulseTimes &pulseTimes) {
+  std::lock_guard<std::mutex> lock(m_pulseTablesMutex);
+  auto &table = m_pulseTables[&pulseTimes];
+  if (!table) {
+    auto times = std::make_shared<std::vector<int64_t>>();
+    times->reserve(pulseTimes.numPulses);
+    for (size_t i = 0; i < pulseTimes.numPulses; ++i)
+      times->emplace_back(pulseTimes.pulseTimes[i].totalNanoseconds());
+    std::sort(times->begin(), times->end());
+    times->erase(std::unique(times->begin(), times->end()), times->end());
+    times->shrink_to_fit();
+    table = std::move(times);
+  }
+  return table;
+}
+
 } // namespace DataHandling
 } // namespace Mantid
@@ -229,6 +229,17 @@ void EventWorkspaceCollection::setAllX(const HistogramData::BinEdges &x) {
 size_t EventWorkspaceCollection::getNumberEvents() const {
   return m_WsVec[0]->getNumberEvents(); // Should be the sum across all periods?
 }
+void EventWorkspaceCollection::packColumns() {
+  for (auto &ws : m_WsVec) {
+    ws->packColumns();
+  }
+}
+void EventWorkspaceCollection::packCompactEvents(
+    const std::shared_ptr<const std::vector<int64_t>> &pulseTable) {
+  for (auto &ws : m_WsVec) {
+    ws->packCompactEvents(pulseTable);
+  }
+}
 
 void EventWorkspaceCollection::setIndexInfo(
     const Indexing::IndexInfo &indexInfo) {
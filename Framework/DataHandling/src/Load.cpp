@@ -24,6 +24,7 @@
 #include <cctype>
 #include <cstdio>
 #include <functional>
+#include <future>
 #include <numeric>
 #include <set>
 
@@ -410,18 +411,37 @@ void Load::loadMultipleFiles() {
   std::vector<API::Workspace_sptr> loadedWsList;
   loadedWsList.reserve(allFilenames.size());
 
-  Workspace_sptr tempWs;
-
   // Cycle through the filenames and wsNames.
   for (auto filenames = allFilenames.cbegin(); filenames != allFilenames.cend();
        ++filenames, ++wsName) {
     auto filename = filenames->cbegin();
     Workspace_sptr sumWS = loadFileToWs(*filename, *wsName);
 
+    // Each file is loaded in another thread while the previous one is added
+    // to the sum in this thread, so at most two files are held besides the
+    // sum. Only one file is read at a time, as the loaders may not be
+    // thread-safe. The files to add are not put in the analysis data service.
+    auto loadAhead = [this](const std::string &fileName) {
+      // Child algorithms are only created in this thread
+      auto loadAlg = createLoadAlgorithm(fileName, "__@loadsum_temp@");
+      return std::async(std::launch::async, [loadAlg]() -> Workspace_sptr {
+        loadAlg->executeAsChildAlg();
+        Workspace_sptr ws = loadAlg->getProperty("OutputWorkspace");
+        return ws;
+      });
+    };
+    std::future<Workspace_sptr> loading;
     ++filename;
-    for (; filename != filenames->cend(); ++filename) {
-      tempWs = loadFileToWs(*filename, "__@loadsum_temp@");
-      sumWS = plusWs(sumWS, tempWs);
+    if (filename != filenames->cend())
+      loading = loadAhead(*filename);
+    while (loading.valid()) {
+      Workspace_sptr tempWs = loading.get();
+      ++filename;
+      if (filename != filenames->cend())
+        loading = loadAhead(*filename);
+      interruption_point();
+      for (const auto &plusAlg : createPlusAlgorithms(sumWS, tempWs))
+        plusAlg->executeAsChildAlg();
     }
 
     API::WorkspaceGroup_sptr group =
@@ -481,15 +501,6 @@ void Load::loadMultipleFiles() {
     }
   }
 
-  // Clean up.
-  if (tempWs) {
-    Algorithm_sptr alg =
-        AlgorithmManager::Instance().createUnmanaged("DeleteWorkspace");
-    alg->initialize();
-    alg->setChild(true);
-    alg->setProperty("Workspace", tempWs);
-    alg->execute();
-  }
 }
 
 /**
@@ -656,6 +667,26 @@ void Load::cancel() {
  */
 API::Workspace_sptr Load::loadFileToWs(const std::string &fileName,
                                        const std::string &wsName) {
+  auto loadAlg = createLoadAlgorithm(fileName, wsName);
+  loadAlg->executeAsChildAlg();
+
+  Workspace_sptr ws = loadAlg->getProperty("OutputWorkspace");
+  // ws->setName(wsName);
+  AnalysisDataService::Instance().addOrReplace(wsName, ws);
+  return ws;
+}
+
+/**
+ * Create the child algorithm loading a file, with the properties of this
+ * algorithm.
+ *
+ * @param fileName :: file name to load.
+ * @param wsName   :: name of the output workspace
+ *
+ * @returns the Load algorithm, ready to be executed.
+ */
+API::IAlgorithm_sptr Load::createLoadAlgorithm(const std::string &fileName,
+                                               const std::string &wsName) {
   Mantid::API::IAlgorithm_sptr loadAlg = createChildAlgorithm("Load", 1);
 
   // Get the list properties for the concrete loader load algorithm
@@ -675,28 +706,34 @@ API::Workspace_sptr Load::loadFileToWs(const std::string &fileName,
       }
     }
   }
-
-  loadAlg->executeAsChildAlg();
-
-  Workspace_sptr ws = loadAlg->getProperty("OutputWorkspace");
-  // ws->setName(wsName);
-  AnalysisDataService::Instance().addOrReplace(wsName, ws);
-  return ws;
+  return loadAlg;
 }
 
 /**
- * Plus two workspaces together, "in place".
+ * Create the algorithms adding two workspaces together, "in place": one for
+ * each pair of child workspaces if they are groups.
  *
- * @param ws1 :: The first workspace.
+ * @param ws1 :: The first workspace, to which the second one is added.
  * @param ws2 :: The second workspace.
  *
- * @returns a pointer to the result (the first workspace).
+ * @returns the Plus algorithms, ready to be executed.
  */
-API::Workspace_sptr Load::plusWs(Workspace_sptr ws1,
-                                 const Workspace_sptr &ws2) {
+std::vector<API::IAlgorithm_sptr>
+Load::createPlusAlgorithms(const Workspace_sptr &ws1,
+                           const Workspace_sptr &ws2) {
   WorkspaceGroup_sptr group1 = std::dynamic_pointer_cast<WorkspaceGroup>(ws1);
   WorkspaceGroup_sptr group2 = std::dynamic_pointer_cast<WorkspaceGroup>(ws2);
 
+  auto createPlus = [this](const Workspace_sptr &lhs,
+                           const Workspace_sptr &rhs) {
+    Mantid::API::IAlgorithm_sptr plusAlg = createChildAlgorithm("Plus", 1);
+    plusAlg->setProperty<Workspace_sptr>("LHSWorkspace", lhs);
+    plusAlg->setProperty<Workspace_sptr>("RHSWorkspace", rhs);
+    plusAlg->setProperty<Workspace_sptr>("OutputWorkspace", lhs);
+    return plusAlg;
+  };
+
+  std::vector<API::IAlgorithm_sptr> plusAlgs;
   if (group1 && group2) {
     // If we're dealing with groups, then the child workspaces must be added
     // separately - setProperty
@@ -713,27 +750,17 @@ API::Workspace_sptr Load::plusWs(Workspace_sptr ws1,
 
     for (; group1ChildWsName != group1ChildWsNames.end();
          ++group1ChildWsName, ++group2ChildWsName) {
-      Workspace_sptr group1ChildWs = group1->getItem(*group1ChildWsName);
-      Workspace_sptr group2ChildWs = group2->getItem(*group2ChildWsName);
-
-      Mantid::API::IAlgorithm_sptr plusAlg = createChildAlgorithm("Plus", 1);
-      plusAlg->setProperty<Workspace_sptr>("LHSWorkspace", group1ChildWs);
-      plusAlg->setProperty<Workspace_sptr>("RHSWorkspace", group2ChildWs);
-      plusAlg->setProperty<Workspace_sptr>("OutputWorkspace", group1ChildWs);
-      plusAlg->executeAsChildAlg();
+      plusAlgs.emplace_back(createPlus(group1->getItem(*group1ChildWsName),
+                                       group2->getItem(*group2ChildWsName)));
     }
   } else if (!group1 && !group2) {
-    Mantid::API::IAlgorithm_sptr plusAlg = createChildAlgorithm("Plus", 1);
-    plusAlg->setProperty<Workspace_sptr>("LHSWorkspace", ws1);
-    plusAlg->setProperty<Workspace_sptr>("RHSWorkspace", ws2);
-    plusAlg->setProperty<Workspace_sptr>("OutputWorkspace", ws1);
-    plusAlg->executeAsChildAlg();
+    plusAlgs.emplace_back(createPlus(ws1, ws2));
   } else {
     throw std::runtime_error(
         "Unable to add a group workspace to a non-group workspace");
   }
 
-  return ws1;
+  return plusAlgs;
 }
 
 /**
@@ -17,6 +17,7 @@
 #include "MantidHistogramData/HistogramMath.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/StringTokenizer.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VisibleWhenProperty.h"
@@ -26,6 +27,8 @@
 #include <boost/regex.hpp>
 #include <boost/tokenizer.hpp>
 
+#include <cctype>
+#include <cstdlib>
 #include <fstream>
 
 namespace Mantid {
@@ -35,6 +38,40 @@ DECLARE_FILELOADER_ALGORITHM(LoadAscii2)
 using namespace Kernel;
 using namespace API;
 
+namespace {
+/// Number of bytes of the file read at once, whose lines are converted in
+/// parallel
+constexpr size_t BLOCK_BYTES = 1 << 24;
+
+bool isSpace(const char c) {
+  return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+/** Convert a column to a number, as boost::lexical_cast would. "nan" and
+ * "1.#qnan", in any case, are read as NaN.
+ * @param begin :: start of the column
+ * @param end :: end of the column
+ * @param[out] value :: the number
+ * @return true if the whole column is a number
+ */
+bool toDouble(const char *begin, const char *end, double &value) {
+  while (begin != end && isSpace(*begin))
+    ++begin;
+  while (end != begin && isSpace(*(end - 1)))
+    --end;
+  std::string column(begin, end);
+  if (column.empty())
+    return false;
+  if (boost::iequals(column, "nan") || boost::iequals(column, "1.#qnan")) {
+    value = std::numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+  char *parsed = nullptr;
+  value = std::strtod(column.c_str(), &parsed);
+  return parsed == column.c_str() + column.size();
+}
+} // namespace
+
 /// Empty constructor
 LoadAscii2::LoadAscii2()
     : m_columnSep(), m_separatorIndex(), m_comment(), m_baseCols(0),
@@ -107,17 +144,58 @@ API::Workspace_sptr LoadAscii2::readData(std::ifstream &file) {
   std::list<std::string> columns;
 
   setcolumns(file, line, columns);
+  m_curX.clear();
+  m_curY.clear();
+  m_curE.clear();
+  m_curDx.clear();
+
+  // The rest of the file is read in blocks of whole lines. The lines of a
+  // block are split and converted to numbers in parallel, then added to the
+  // spectra in order.
+  std::string block;
+  std::vector<std::pair<size_t, size_t>> lineRanges;
+  std::vector<DataLine> lines;
+  while (file) {
+    const size_t kept = block.size();
+    block.resize(kept + BLOCK_BYTES);
+    file.read(&block[kept], BLOCK_BYTES);
+    block.resize(kept + static_cast<size_t>(file.gcount()));
+
+    // Keep the last line for the next block, unless the file has ended
+    size_t blockEnd = block.size();
+    if (file) {
+      const size_t lastNewline = block.rfind('\n');
+      if (lastNewline == std::string::npos)
+        continue;
+      blockEnd = lastNewline + 1;
+    }
+    lineRanges.clear();
+    for (size_t start = 0; start < blockEnd;) {
+      const size_t newline = std::min(block.find('\n', start), blockEnd);
+      lineRanges.emplace_back(start, newline);
+      start = newline + 1;
+    }
 
-  while (getline(file, line)) {
-    std::string templine = line;
-    m_lineNo++;
-    boost::trim(templine);
-    if (templine.empty()) {
-      // the line is empty, treat as a break before a new spectra
-      newSpectra();
-    } else if (!skipLine(templine)) {
-      parseLine(templine, columns);
+    lines.resize(lineRanges.size());
+    const char *data = block.data();
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < static_cast<int64_t>(lineRanges.size()); ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      lines[i] = convertLine(data + lineRanges[i].first,
+                             data + lineRanges[i].second);
+      PARALLEL_END_INTERUPT_REGION
     }
+    PARALLEL_CHECK_INTERUPT_REGION
+    for (const auto &dataLine : lines) {
+      m_lineNo++;
+      if (dataLine.kind == DataLine::Kind::Empty) {
+        // the line is empty, treat as a break before a new spectra
+        newSpectra();
+      } else if (dataLine.kind != DataLine::Kind::Comment) {
+        parseLine(dataLine);
+      }
+    }
+    block.erase(0, blockEnd);
   }
 
   newSpectra();
@@ -282,79 +360,137 @@ API::Workspace_sptr LoadAscii2::readTable(std::ifstream &file) {
 }
 
 /**
- * Check the start of the file for the first data set, then set the number of
- * columns that hsould be expected thereafter
- * @param[in] line : The current line of data
- * @param[in] columns : the columns of values in the current line of data
+ * Split a line of data into columns, at runs of separators, and convert the
+ * columns to numbers. This does not change the state of the loader, so may be
+ * called in parallel for several lines.
+ * @param begin :: start of the line
+ * @param end :: end of the line, excluding the newline
+ * @return the kind of line, and its values
  */
-void LoadAscii2::parseLine(const std::string &line,
-                           std::list<std::string> &columns) {
-  if (std::isdigit(line.at(0)) || line.at(0) == '-' || line.at(0) == '+') {
-    const int cols = splitIntoColumns(columns, line);
-    if (cols > 4 || cols < 0) {
-      // there were more separators than there should have been, which isn't
-      // right, or something went rather wrong
-      throw std::runtime_error(
-          "Line " + std::to_string(m_lineNo) +
-          ": Sets of values must have between 1 and 3 delimiters");
-    } else if (cols == 1) {
-      // a size of 1 is a spectra ID as long as there are no alphabetic
-      // characters in it. Signifies the start of a new spectra if it wasn't
-      // preceeded with a blank line
-      newSpectra();
-
-      // at this point both vectors should be the same size (or the ID counter
-      // should be 0, but as we're here then that's out the window),
-      if (m_spectra.size() == m_spectrumIDcount) {
-        m_spectrumIDcount++;
-      } else {
-        // if not then they've ommitted IDs in the the file previously and just
-        // decided to include one (which is wrong and confuses everything)
-        throw std::runtime_error(
-            "Line " + std::to_string(m_lineNo) +
-            ": Inconsistent inclusion of spectra IDs. All spectra must have "
-            "IDs or all spectra must not have IDs. "
-            "Check for blank lines, as they symbolize the end of one spectra "
-            "and the start of another. Also check for spectra IDs with no "
-            "associated bins.");
-      }
-      const std::string singleNumber = columns.front();
-      try {
-        m_curSpectra->setSpectrumNo(boost::lexical_cast<int>(singleNumber));
-      } catch (boost::bad_lexical_cast &) {
-        // the single column number is not the spectrum ID, maybe it is the
-        // spectrum axis value
-        try {
-          m_spectrumAxis.emplace_back(
-              boost::lexical_cast<double>(singleNumber));
-        } catch (boost::bad_lexical_cast &) {
-          throw std::runtime_error("Unable to read as spectrum ID (int) nor as "
-                                   "spectrum axis value (double)" +
-                                   singleNumber);
-        }
-      }
-    } else {
-      inconsistantIDCheck();
+LoadAscii2::DataLine LoadAscii2::convertLine(const char *begin,
+                                             const char *end) const {
+  DataLine line;
+  while (begin != end && isSpace(*begin))
+    ++begin;
+  while (end != begin && isSpace(*(end - 1)))
+    --end;
+  if (begin == end)
+    return line;
+
+  const char first = *begin;
+  if (first == m_comment.at(0)) {
+    line.kind = DataLine::Kind::Comment;
+    return line;
+  }
+  if (!(std::isdigit(first) || first == '-' || first == '+')) {
+    line.kind = DataLine::Kind::Invalid;
+    line.text.assign(begin, end);
+    return line;
+  }
 
-      checkLineColumns(cols);
+  // Split as boost::split with token_compress_on: a trailing separator makes
+  // an empty last column
+  const auto isSeparator = [this](const char c) {
+    return m_columnSep.find(c) != std::string::npos;
+  };
+  std::array<std::pair<const char *, const char *>, 4> columns;
+  const char *columnStart = begin;
+  for (const char *c = begin;;) {
+    if (c == end || isSeparator(*c)) {
+      if (line.columns < columns.size())
+        columns[line.columns] = {columnStart, c};
+      ++line.columns;
+      if (c == end)
+        break;
+      while (c != end && isSeparator(*c))
+        ++c;
+      columnStart = c;
+    } else {
+      ++c;
+    }
+  }
 
-      addToCurrentSpectra(columns);
+  if (line.columns == 1) {
+    line.kind = DataLine::Kind::Single;
+    line.text.assign(begin, end);
+  } else {
+    line.kind = DataLine::Kind::Values;
+    for (size_t i = 0; i < std::min(line.columns, columns.size()); ++i) {
+      if (!toDouble(columns[i].first, columns[i].second, line.values[i])) {
+        line.kind = DataLine::Kind::BadValue;
+        line.text.assign(begin, end);
+        break;
+      }
     }
-  } else if (badLine(line)) {
+  }
+  return line;
+}
+
+/**
+ * Interpret a line of data, adding its values to the current spectrum
+ * @param[in] line : The line, split into columns and converted
+ */
+void LoadAscii2::parseLine(const DataLine &line) {
+  if (line.kind == DataLine::Kind::Invalid) {
     throw std::runtime_error(
         "Line " + std::to_string(m_lineNo) +
         ": Unexpected character found at beginning of line. Lines must either "
         "be a single integer, a list of numeric values, blank, or a text line "
         "beginning with the specified comment indicator: " +
         m_comment + ".");
-  } else {
-    // strictly speaking this should never be hit, but just being sure
+  }
+  if (line.columns > 4) {
+    // there were more separators than there should have been, which isn't
+    // right, or something went rather wrong
     throw std::runtime_error(
         "Line " + std::to_string(m_lineNo) +
-        ": Unknown format at line. Lines must either be a single integer, a "
-        "list of numeric values, blank, or a text line beginning with the "
-        "specified comment indicator: " +
-        m_comment + ".");
+        ": Sets of values must have between 1 and 3 delimiters");
+  } else if (line.kind == DataLine::Kind::Single) {
+    // a size of 1 is a spectra ID as long as there are no alphabetic
+    // characters in it. Signifies the start of a new spectra if it wasn't
+    // preceeded with a blank line
+    newSpectra();
+
+    // at this point both vectors should be the same size (or the ID counter
+    // should be 0, but as we're here then that's out the window),
+    if (m_spectra.size() == m_spectrumIDcount) {
+      m_spectrumIDcount++;
+    } else {
+      // if not then they've ommitted IDs in the the file previously and just
+      // decided to include one (which is wrong and confuses everything)
+      throw std::runtime_error(
+          "Line " + std::to_string(m_lineNo) +
+          ": Inconsistent inclusion of spectra IDs. All spectra must have "
+          "IDs or all spectra must not have IDs. "
+          "Check for blank lines, as they symbolize the end of one spectra "
+          "and the start of another. Also check for spectra IDs with no "
+          "associated bins.");
+    }
+    const std::string &singleNumber = line.text;
+    try {
+      m_curSpectra->setSpectrumNo(boost::lexical_cast<int>(singleNumber));
+    } catch (boost::bad_lexical_cast &) {
+      // the single column number is not the spectrum ID, maybe it is the
+      // spectrum axis value
+      try {
+        m_spectrumAxis.emplace_back(boost::lexical_cast<double>(singleNumber));
+      } catch (boost::bad_lexical_cast &) {
+        throw std::runtime_error("Unable to read as spectrum ID (int) nor as "
+                                 "spectrum axis value (double)" +
+                                 singleNumber);
+      }
+    }
+  } else {
+    inconsistantIDCheck();
+
+    checkLineColumns(line.columns);
+
+    if (line.kind == DataLine::Kind::BadValue) {
+      throw std::runtime_error("Line " + std::to_string(m_lineNo) +
+                               ": Unable to read the values of line: " +
+                               line.text);
+    }
+    addToCurrentSpectra(line.values);
   }
 }
 
@@ -598,19 +734,14 @@ void LoadAscii2::processHeader(std::ifstream &file) {
 }
 
 /**
- * Check if the file has been found to inconsistently include spectra IDs
- * @param[in] columns : the columns of values in the current line of data
+ * Add the values of the current line of data to the current spectrum
+ * @param[in] values : the values of the current line of data
  */
-void LoadAscii2::addToCurrentSpectra(std::list<std::string> &columns) {
-  std::vector<double> values(m_baseCols, 0.);
+void LoadAscii2::addToCurrentSpectra(const std::array<double, 4> &values) {
   m_spectraStart = false;
-  fillInputValues(values, columns);
   // add X and Y
-  auto histo = m_curSpectra->histogram();
-  histo.resize(histo.size() + 1);
-
-  histo.mutableX().back() = values[0];
-  histo.mutableY().back() = values[1];
+  m_curX.emplace_back(values[0]);
+  m_curY.emplace_back(values[1]);
 
   // check for E and DX
   switch (m_baseCols) {
@@ -618,17 +749,16 @@ void LoadAscii2::addToCurrentSpectra(std::list<std::string> &columns) {
   // workspace, omit DX
   case 3: {
     // E in file, include it, omit DX
-    histo.mutableE().back() = values[2];
+    m_curE.emplace_back(values[2]);
     break;
   }
   case 4: {
     // E and DX in file, include both
-    histo.mutableE().back() = values[2];
+    m_curE.emplace_back(values[2]);
     m_curDx.emplace_back(values[3]);
     break;
   }
   }
-  m_curSpectra->setHistogram(histo);
   m_curBins++;
 }
 
@@ -680,9 +810,15 @@ void LoadAscii2::newSpectra() {
     }
 
     if (m_curSpectra) {
-      size_t specSize = m_curSpectra->size();
+      size_t specSize = m_curX.size();
       if (specSize > 0 && specSize == m_lastBins) {
-        if (m_curSpectra->x().size() == m_curDx.size())
+        // E = 0 unless given in the file
+        m_curE.resize(specSize);
+        m_curSpectra->setHistogram(
+            HistogramData::Points(std::move(m_curX)),
+            HistogramData::Counts(std::move(m_curY)),
+            HistogramData::CountStandardDeviations(std::move(m_curE)));
+        if (specSize == m_curDx.size())
           m_curSpectra->setPointStandardDeviations(std::move(m_curDx));
         m_spectra.emplace_back(*m_curSpectra);
       }
@@ -692,6 +828,9 @@ void LoadAscii2::newSpectra() {
     m_curSpectra = std::make_unique<DataObjects::Histogram1D>(
         HistogramData::Histogram::XMode::Points,
         HistogramData::Histogram::YMode::Counts);
+    m_curX.clear();
+    m_curY.clear();
+    m_curE.clear();
     m_curDx.clear();
     m_spectraStart = true;
   }
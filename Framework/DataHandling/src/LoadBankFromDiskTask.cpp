@@ -9,6 +9,7 @@
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataHandling/ProcessBankData.h"
+#include "MantidKernel/Timer.h"
 #include "MantidKernel/Unit.h"
 #include <algorithm>
 
@@ -106,7 +107,9 @@ LoadBankFromDiskTask::loadEventIndex(::NeXus::File &file) {
   return event_index;
 }
 
-/** Open the event_id field and validate the contents
+/** Open the event_id field and validate the contents. The range of events
+ * to load is that of the pulses in the time window, from event_index,
+ * intersected with the range of the chunk when loading in chunks.
  *
  * @param file :: File handle for the NeXus file
  * @param start_event :: set to the index of the first event
@@ -131,13 +134,21 @@ void LoadBankFromDiskTask::prepareEventId(
   int64_t dim0 = recalculateDataSize(id_info.dims[0]);
   stop_event = dim0;
 
-  // Handle the time filtering by changing the start/end offsets.
-  for (size_t i = 0; i < thisBankPulseTimes->numPulses; i++) {
-    if (thisBankPulseTimes->pulseTimes[i] >= m_loader.alg->filter_time_start) {
-      start_event = static_cast<int64_t>(event_index[i]);
+  // Handle the time filtering by changing the start/end offsets. Only the
+  // pulses with an entry in event_index can be located in the events.
+  const size_t numPulses =
+      std::min(thisBankPulseTimes->numPulses, event_index.size());
+  size_t startPulse = 0;
+  for (; startPulse < numPulses; startPulse++) {
+    if (thisBankPulseTimes->pulseTimes[startPulse] >=
+        m_loader.alg->filter_time_start) {
+      start_event = static_cast<int64_t>(event_index[startPulse]);
       break; // stop looking
     }
   }
+  // All the pulses are before the time window
+  if (numPulses > 0 && startPulse == numPulses)
+    start_event = dim0;
 
   if (start_event > dim0) {
     // If the frame indexes are bad then we can't construct the times of the
@@ -152,22 +163,25 @@ void LoadBankFromDiskTask::prepareEventId(
     start_event = 0;
     stop_event = dim0;
   } else {
-    for (size_t i = 0; i < thisBankPulseTimes->numPulses; i++) {
+    // The window ends at or after its first pulse
+    for (size_t i = startPulse; i < numPulses; i++) {
       if (thisBankPulseTimes->pulseTimes[i] > m_loader.alg->filter_time_stop) {
         stop_event = event_index[i];
         break;
       }
     }
   }
-  // We are loading part - work out the event number range
+  // We are loading part - work out the event number range of the chunk and
+  // keep the part of it in the time window
   if (m_loader.chunk != EMPTY_INT()) {
-    start_event =
+    const auto chunk_start =
         static_cast<int64_t>(m_loader.chunk - m_loader.firstChunkForBank) *
         static_cast<int64_t>(m_loader.eventsPerChunk);
+    start_event = std::max(start_event, chunk_start);
     // Don't change stop_event for the final chunk
-    if (start_event + static_cast<int64_t>(m_loader.eventsPerChunk) <
+    if (chunk_start + static_cast<int64_t>(m_loader.eventsPerChunk) <
         stop_event)
-      stop_event = start_event + static_cast<int64_t>(m_loader.eventsPerChunk);
+      stop_event = chunk_start + static_cast<int64_t>(m_loader.eventsPerChunk);
   }
 
   // Make sure it is within range
@@ -181,16 +195,16 @@ void LoadBankFromDiskTask::prepareEventId(
 
 /** Load the event_id field, which has been opened
  * @param file An NeXus::File object opened at the correct group
- * @returns A new array containing the event Ids for this bank
+ * @returns A buffer from the pool containing the event Ids for this bank
  */
-std::unique_ptr<std::vector<uint32_t>>
+std::shared_ptr<std::vector<uint32_t>>
 LoadBankFromDiskTask::loadEventId(::NeXus::File &file) {
   // This is the data size
   ::NeXus::Info id_info = file.getInfo();
   int64_t dim0 = recalculateDataSize(id_info.dims[0]);
 
-  // Now we allocate the required arrays
-  auto event_id = std::make_unique<std::vector<uint32_t>>(m_loadSize[0]);
+  // Now we get the required arrays
+  auto event_id = m_loader.bufferPool.acquire<uint32_t>(m_loadSize[0]);
 
   // Check that the required space is there in the file.
   if (dim0 < m_loadSize[0] + m_loadStart[0]) {
@@ -246,13 +260,12 @@ LoadBankFromDiskTask::loadEventId(::NeXus::File &file) {
 
 /** Open and load the times-of-flight data
  * @param file An NeXus::File object opened at the correct group
- * @returns A new array containing the time of flights for this bank
+ * @returns A buffer from the pool containing the time of flights for this bank
  */
-std::unique_ptr<std::vector<float>>
+std::shared_ptr<std::vector<float>>
 LoadBankFromDiskTask::loadTof(::NeXus::File &file) {
-  // Allocate the array
-  auto event_time_of_flight =
-      std::make_unique<std::vector<float>>(m_loadSize[0]);
+  // Get the array
+  auto event_time_of_flight = m_loader.bufferPool.acquire<float>(m_loadSize[0]);
 
   // Get the list of event_time_of_flight's
   std::string key, tof_unit;
@@ -274,26 +287,30 @@ LoadBankFromDiskTask::loadTof(::NeXus::File &file) {
   }
 
   // The Nexus standard does not specify if event_time_offset should be float or
-  // integer, so we use the NeXusIOHelper to perform the conversion to float on
-  // the fly. If the data field already contains floats, the conversion is
-  // skipped.
-  auto vec = NeXus::NeXusIOHelper::readNexusSlab<float>(file, key, m_loadStart,
-                                                        m_loadSize);
+  // integer. Floats are read straight into the buffer, otherwise we use the
+  // NeXusIOHelper to perform the conversion to float on the fly.
+  if (tof_info.type == ::NeXus::FLOAT32) {
+    file.getSlab(event_time_of_flight->data(), m_loadStart, m_loadSize);
+  } else {
+    auto vec = NeXus::NeXusIOHelper::readNexusSlab<float>(
+        file, key, m_loadStart, m_loadSize);
+    std::copy(vec.begin(), vec.end(), event_time_of_flight->data());
+  }
   file.getAttr("units", tof_unit);
   file.closeData();
   // Convert Tof to microseconds
-  Kernel::Units::timeConversionVector(vec, tof_unit, "microseconds");
-  std::copy(vec.begin(), vec.end(), event_time_of_flight->data());
+  Kernel::Units::timeConversionVector(*event_time_of_flight, tof_unit,
+                                      "microseconds");
 
   return event_time_of_flight;
 }
 
 /** Load weight of weigthed events if they exist
  * @param file An NeXus::File object opened at the correct group
- * @returns A new array containing the weights or a nullptr if the weights
- * are not present
+ * @returns A buffer from the pool containing the weights or a nullptr if the
+ * weights are not present
  */
-std::unique_ptr<std::vector<float>>
+std::shared_ptr<std::vector<float>>
 LoadBankFromDiskTask::loadEventWeights(::NeXus::File &file) {
   try {
     // First, get info about the event_weight field in this bank
@@ -301,13 +318,13 @@ LoadBankFromDiskTask::loadEventWeights(::NeXus::File &file) {
   } catch (::NeXus::Exception &) {
     // Field not found error is most likely.
     m_have_weight = false;
-    return std::unique_ptr<std::vector<float>>();
+    return std::shared_ptr<std::vector<float>>();
   }
   // OK, we've got them
   m_have_weight = true;
 
-  // Allocate the array
-  auto event_weight = std::make_unique<std::vector<float>>(m_loadSize[0]);
+  // Get the array
+  auto event_weight = m_loader.bufferPool.acquire<float>(m_loadSize[0]);
 
   ::NeXus::Info weight_info = file.getInfo();
   int64_t weight_dim0 = recalculateDataSize(weight_info.dims[0]);
@@ -344,11 +361,13 @@ void LoadBankFromDiskTask::run() {
   m_have_weight = m_loader.m_haveWeights;
 
   prog->report(entry_name + ": load from disk");
+  Kernel::Timer timer;
+  double readingTime = 0.;
 
   // arrays to load into
-  std::unique_ptr<std::vector<uint32_t>> event_id;
-  std::unique_ptr<std::vector<float>> event_time_of_flight;
-  std::unique_ptr<std::vector<float>> event_weight;
+  std::shared_ptr<std::vector<uint32_t>> event_id;
+  std::shared_ptr<std::vector<float>> event_time_of_flight;
+  std::shared_ptr<std::vector<float>> event_weight;
   std::vector<uint64_t> event_index;
 
   // Open the file
@@ -384,6 +403,15 @@ void LoadBankFromDiskTask::run() {
       m_loadSize[0] = stop_event - start_event;
 
       if ((m_loadSize[0] > 0) && (m_loadStart[0] >= 0)) {
+        // Wait for the banks read before to be processed if they take too
+        // much memory
+        readingTime += timer.elapsed();
+        const auto eventSize =
+            sizeof(uint32_t) + sizeof(float) * (m_have_weight ? 2 : 1);
+        m_loader.bufferPool.waitForMemory(
+            static_cast<size_t>(m_loadSize[0]) * eventSize);
+        timer.reset();
+
         // Load pixel IDs
         event_id = this->loadEventId(file);
         if (m_loader.alg->getCancel()) {
@@ -400,12 +428,17 @@ void LoadBankFromDiskTask::run() {
           }
         }
       } // Size is at least 1
-      else {
-        // Found a size that was 0 or less; stop processing
+      else if (m_loadStart[0] >= 0) {
+        // None of the events of the bank are in the time window or chunk
+        m_loader.alg->getLogger().debug()
+            << "Bank " << entry_name
+            << " has no events in the time window or chunk to load.\n";
+        m_loadError = true;
+      } else {
+        // Found a negative start index; stop processing
         m_loader.alg->getLogger().error()
             << "Loading bank " << entry_name
-            << " is stopped due to either zero/negative loading size ("
-            << m_loadStart[0] << ") or negative load start index ("
+            << " is stopped due to a negative load start index ("
             << m_loadStart[0] << ")\n";
         m_loadError = true;
       }
@@ -427,6 +460,7 @@ void LoadBankFromDiskTask::run() {
   // Close up the file even if errors occured.
   file.closeGroup();
   file.close();
+  m_loader.bufferPool.addReadingTime(readingTime + timer.elapsed());
 
   // Abort if anything failed
   if (m_loadError) {
@@ -472,24 +506,21 @@ void LoadBankFromDiskTask::run() {
   auto numEvents = static_cast<size_t>(m_loadSize[0]);
   auto startAt = static_cast<size_t>(m_loadStart[0]);
 
-  // convert things to shared_arrays to share between tasks
-  std::shared_ptr<std::vector<uint32_t>> event_id_shrd(event_id.release());
-  std::shared_ptr<std::vector<float>> event_time_of_flight_shrd(
-      event_time_of_flight.release());
-  std::shared_ptr<std::vector<float>> event_weight_shrd(event_weight.release());
+  // The buffers are shared between the tasks and go back to the pool once
+  // both are done with them
   auto event_index_shrd =
       std::make_shared<std::vector<uint64_t>>(std::move(event_index));
 
   std::shared_ptr<Task> newTask1 = std::make_shared<ProcessBankData>(
-      m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-      numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
-      event_weight_shrd, m_min_id, mid_id);
+      m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents,
+      startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
+      event_weight, m_min_id, mid_id);
   scheduler.push(newTask1);
   if (m_loader.splitProcessing && (mid_id < m_max_id)) {
     std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankData>(
-        m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-        numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
-        event_weight_shrd, (mid_id + 1), m_max_id);
+        m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents,
+        startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
+        event_weight, (mid_id + 1), m_max_id);
     scheduler.push(newTask2);
   }
 }
@@ -78,7 +78,9 @@ bool exists(const std::map<std::string, std::string> &entries,
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0),
       longest_tof(0), shortest_tof(0), bad_tofs(0), discarded_events(0),
-      compressTolerance(0), m_instrument_loaded_correctly(false),
+      compressTolerance(0), compressWhileReading(false),
+      compactEvents(false),
+      m_instrument_loaded_correctly(false),
       loadlogs(false), event_id_is_spec(false) {}
 
 //----------------------------------------------------------------------------------------------
@@ -191,6 +193,26 @@ void LoadEventNexus::init() {
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
 
+  std::vector<std::string> compressModes{"Exact", "Linear"};
+  declareProperty(
+      "CompressBinningMode", "Exact",
+      std::make_shared<StringListValidator>(compressModes),
+      "How events are grouped when CompressTolerance is set. 'Exact' groups "
+      "them as CompressEvents does once each bank has been read. 'Linear' "
+      "accumulates them into time-of-flight bins of width CompressTolerance "
+      "as they are read, so that the uncompressed events are never held in "
+      "memory.");
+
+  declareProperty(std::make_unique<PropertyWithValue<bool>>(
+                      "CompactEvents", false, Direction::Input),
+                  "Store the events with a single precision time-of-flight and "
+                  "an index into a table of pulse times shared by the spectra "
+                  "of a bank (optional, default False). Each bank is compacted "
+                  "as soon as it is read, which roughly halves the memory used "
+                  "while loading and by the output workspace. Events are "
+                  "expanded to full precision on demand by operations that "
+                  "need it.");
+
   auto mustBePositive = std::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
   declareProperty("ChunkNumber", EMPTY_INT(), mustBePositive,
@@ -205,9 +227,20 @@ void LoadEventNexus::init() {
   setPropertySettings("TotalChunks", std::make_unique<VisibleWhenProperty>(
                                          "ChunkNumber", IS_NOT_DEFAULT));
 
+  declareProperty(std::make_unique<PropertyWithValue<bool>>(
+                      "ColumnarEvents", false, Direction::Input),
+                  "Store the time-of-flight and pulse time of the events in "
+                  "separate columns (optional, default False). Sorting, "
+                  "histogramming, unit conversion and filtering by pulse time "
+                  "then only read the values they need. Other operations "
+                  "expand the events on demand. Ignored with CompactEvents, "
+                  "which also uses columns.");
+
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("CompressBinningMode", grp3);
+  setPropertyGroup("CompactEvents", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -281,21 +314,32 @@ void LoadEventNexus::init() {
   declareProperty(std::make_unique<PropertyWithValue<bool>>("LoadLogs", true,
                                                             Direction::Input),
                   "Load the Sample/DAS logs from the file (default True).");
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>("LogAllowList"),
+      "If given, only the Sample/DAS logs whose names match one of these "
+      "patterns are loaded. The patterns may contain the wildcards * and ?.");
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>("LogBlockList"),
+      "The Sample/DAS logs whose names match one of these patterns are not "
+      "loaded. The patterns may contain the wildcards * and ?.");
   std::vector<std::string> loadType{"Default"};
+  std::map<std::string, std::string> loadTypeAliases;
 
 #ifndef _WIN32
-  loadType.emplace_back("Multiprocess (experimental)");
+  loadType.emplace_back("Multiprocess");
+  loadTypeAliases.emplace("Multiprocess (experimental)", "Multiprocess");
 #endif // _WIN32
 
 #ifdef MPI_EXPERIMENTAL
   loadType.emplace_back("MPI");
 #endif // MPI_EXPERIMENTAL
 
-  auto loadTypeValidator = std::make_shared<StringListValidator>(loadType);
+  auto loadTypeValidator =
+      std::make_shared<StringListValidator>(loadType, loadTypeAliases);
   declareProperty("LoadType", "Default", loadTypeValidator,
-                  "Set type of loader. 2 options {Default, Multiproceess},"
-                  "'Multiprocess' should work faster for big files and it is "
-                  "experimental, available only in Linux");
+                  "Set type of loader. 2 options {Default, Multiprocess},"
+                  "'Multiprocess' reads the banks in several processes and "
+                  "should work faster for big files, available only in Linux");
 
   declareProperty(std::make_unique<PropertyWithValue<bool>>(
                       "LoadNexusInstrumentXML", true, Direction::Input),
@@ -384,6 +428,9 @@ void LoadEventNexus::execLoader() {
   m_filename = getPropertyValue("Filename");
 
   compressTolerance = getProperty("CompressTolerance");
+  compressWhileReading = compressTolerance > 0. &&
+                         getPropertyValue("CompressBinningMode") == "Linear";
+  compactEvents = getProperty("CompactEvents");
 
   loadlogs = getProperty("LoadLogs");
 
@@ -419,6 +466,16 @@ void LoadEventNexus::execLoader() {
   // think)
   filterDuringPause(m_ws->getSingleHeldWorkspace());
 
+  // The banks are compacted as they are loaded. Compact the lists that were
+  // expanded since, e.g. by the filter above, or loaded by another loader.
+  // Plain columns take as much memory as the event vectors, so they are only
+  // packed once the events will no longer be modified.
+  const bool columnarEvents = getProperty("ColumnarEvents");
+  if (compactEvents)
+    m_ws->packCompactEvents(nullptr);
+  else if (columnarEvents)
+    m_ws->packColumns();
+
   // add filename
   m_ws->mutableRun().addProperty("Filename", m_filename);
   // Save output
@@ -584,6 +641,13 @@ std::shared_ptr<BankPulseTimes> LoadEventNexus::runLoadNexusLogs(
                                  alg.getPropertyValue("NXentryName"));
     } catch (...) {
     }
+    try {
+      loadLogs->setPropertyValue("LogAllowList",
+                                 alg.getPropertyValue("LogAllowList"));
+      loadLogs->setPropertyValue("LogBlockList",
+                                 alg.getPropertyValue("LogBlockList"));
+    } catch (...) {
+    }
 
     loadLogs->execute();
 
@@ -1036,14 +1100,18 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
         }
       };
 
+      Parallel::IO::EventFilter filter;
+      filter.tofMin = filter_tof_min;
+      filter.tofMax = filter_tof_max;
+      filter.pulseTimeMin = filter_time_start.totalNanoseconds();
+      filter.pulseTimeMax = filter_time_stop.totalNanoseconds();
       try {
         ParallelEventLoader::loadMultiProcess(*ws, m_filename, m_top_entry_name,
                                               bankNames, event_id_is_spec,
-                                              getProperty("Precount"));
+                                              getProperty("Precount"), filter);
         g_log.information() << "Used Multiprocess ParallelEventLoader.\n";
         loaded = true;
-        shortest_tof = 0.0;
-        longest_tof = 1e10;
+        ws->getEventXMinMax(shortest_tof, longest_tof);
       } catch (const std::exception &e) {
         ExceptionOutput::out(g_log, e);
         g_log.warning() << "\nMultiprocess event loader failed, falling back "
@@ -1545,8 +1613,10 @@ void LoadEventNexus::safeOpenFile(const std::string &fname) {
   }
 }
 
-/// The parallel loader currently has no support for a series of special
-/// cases, as indicated by the return value of this method.
+/// The parallel loaders currently have no support for a series of special
+/// cases, as indicated by the return value of this method. The multiprocess
+/// loader supports filtering by time-of-flight and pulse time, and spectrum
+/// selections when event IDs are detector IDs.
 LoadEventNexus::LoaderType
 LoadEventNexus::defineLoaderType(const bool haveWeights,
                                  const bool oldNeXusFileNames,
@@ -1560,23 +1630,26 @@ LoadEventNexus::defineLoaderType(const bool haveWeights,
   noParallelConstrictions &= !haveWeights;
   noParallelConstrictions &= !oldNeXusFileNames;
   noParallelConstrictions &=
-      !(filter_tof_min != -1e20 || filter_tof_max != 1e20);
-  noParallelConstrictions &=
-      !((filter_time_start != Types::Core::DateAndTime::minimum() ||
-         filter_time_stop != Types::Core::DateAndTime::maximum()));
-  noParallelConstrictions &=
-      !((!isDefault("CompressTolerance") || !isDefault("SpectrumMin") ||
-         !isDefault("SpectrumMax") || !isDefault("SpectrumList") ||
-         !isDefault("ChunkNumber")));
+      !((!isDefault("CompressTolerance") || !isDefault("ChunkNumber")));
   noParallelConstrictions &= !(classType != "NXevent_data");
 
-  if (!noParallelConstrictions)
+  const bool spectrumSelection = !isDefault("SpectrumMin") ||
+                                 !isDefault("SpectrumMax") ||
+                                 !isDefault("SpectrumList");
+#ifdef MPI_EXPERIMENTAL
+  if (propVal == "MPI") {
+    const bool filtered =
+        filter_tof_min != -1e20 || filter_tof_max != 1e20 ||
+        filter_time_start != Types::Core::DateAndTime::minimum() ||
+        filter_time_stop != Types::Core::DateAndTime::maximum();
+    return noParallelConstrictions && !spectrumSelection && !filtered
+               ? LoaderType::MPI
+               : LoaderType::DEFAULT;
+  }
+#endif
+  if (!noParallelConstrictions || (spectrumSelection && event_id_is_spec))
     return LoaderType::DEFAULT;
-#ifndef MPI_EXPERIMENTAL
   return LoaderType::MULTIPROCESS;
-#else
-  return propVal == "MPI" ? LoaderType::MPI : LoaderType::MULTIPROCESS;
-#endif
 }
 
 Parallel::ExecutionMode LoadEventNexus::getParallelExecutionMode(
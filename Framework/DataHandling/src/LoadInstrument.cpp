@@ -19,8 +19,11 @@
 #include "MantidKernel/Strings.h"
 #include "MantidNexusGeometry/NexusGeometryParser.h"
 
+#include <Poco/File.h>
 #include <boost/algorithm/string.hpp>
 
+#include <map>
+
 namespace Mantid {
 namespace DataHandling {
 
@@ -40,6 +43,26 @@ std::recursive_mutex LoadInstrument::m_mutex;
 // if (loader_type < LoaderType::Nxs) then do all things common to Xml and Idf.
 enum class LoaderType { Xml = 1, Idf = 2, Nxs = 3 };
 
+namespace {
+/// Mangled names of the instrument definition files already parsed, keyed by
+/// their idfStamp(). Guarded by LoadInstrument::m_mutex. It only lasts for
+/// the process: parsed instruments are not cached on disk.
+std::map<std::string, std::string> g_mangledNames;
+
+/** Identify an instrument definition file by its path, modification time and
+ * size, so that it need not be read and hashed again to find its mangled name.
+ * @param filename :: path to the instrument definition file
+ * @param instname :: name of the instrument
+ * @return the key of the file in g_mangledNames
+ */
+std::string idfStamp(const std::string &filename, const std::string &instname) {
+  Poco::File file(filename);
+  return instname + '|' + file.path() + '|' +
+         std::to_string(file.getLastModified().epochMicroseconds()) + '|' +
+         std::to_string(file.getSize());
+}
+} // namespace
+
 /// Initialisation method.
 void LoadInstrument::init() {
   // When used as a Child Algorithm the workspace name is not used - hence the
@@ -179,21 +202,40 @@ void LoadInstrument::exec() {
   }
 
   InstrumentDefinitionParser parser;
+  bool hasParser = false;
   std::string instrumentNameMangled;
   Instrument_sptr instrument;
 
   // Define a parser if using IDFs
-  if (loader_type == LoaderType::Xml)
-    parser =
-        InstrumentDefinitionParser(filename, instname, InstrumentXML->value());
-  else if (loader_type == LoaderType::Idf)
-    parser = InstrumentDefinitionParser(filename, instname,
-                                        Strings::loadFile(filename));
+  auto createParser = [&]() {
+    if (loader_type == LoaderType::Xml)
+      parser = InstrumentDefinitionParser(filename, instname,
+                                          InstrumentXML->value());
+    else
+      parser = InstrumentDefinitionParser(filename, instname,
+                                          Strings::loadFile(filename));
+    hasParser = true;
+  };
+
+  // An IDF already parsed need not be read and hashed again, unless it has
+  // changed since
+  std::string stamp;
+  if (loader_type == LoaderType::Idf) {
+    stamp = idfStamp(filename, instname);
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    const auto known = g_mangledNames.find(stamp);
+    if (known != g_mangledNames.end())
+      instrumentNameMangled = known->second;
+  }
 
   // Find the mangled instrument name that includes the modified date
-  if (loader_type < LoaderType::Nxs)
+  if (!instrumentNameMangled.empty()) {
+    g_log.debug() << "Instrument definition " << filename
+                  << " is unchanged since it was last parsed\n";
+  } else if (loader_type < LoaderType::Nxs) {
+    createParser();
     instrumentNameMangled = parser.getMangledName();
-  else if (loader_type == LoaderType::Nxs)
+  } else if (loader_type == LoaderType::Nxs)
     instrumentNameMangled =
         NexusGeometry::NexusGeometryParser::getMangledName(filename, instname);
   else
@@ -211,6 +253,10 @@ void LoadInstrument::exec() {
     } else {
 
       if (loader_type < LoaderType::Nxs) {
+        // The instrument may have been removed from the service since its
+        // definition was last parsed
+        if (!hasParser)
+          createParser();
         // Really create the instrument
         Progress prog(this, 0.0, 1.0, 100);
         instrument = parser.parseXML(&prog);
@@ -230,6 +276,8 @@ void LoadInstrument::exec() {
       // Add to data service for later retrieval
       InstrumentDataService::Instance().add(instrumentNameMangled, instrument);
     }
+    if (!stamp.empty())
+      g_mangledNames[stamp] = instrumentNameMangled;
     ws->setInstrument(instrument);
 
     // populate parameter map of workspace
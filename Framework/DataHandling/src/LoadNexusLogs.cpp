@@ -8,6 +8,7 @@
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/Run.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include <locale>
 #include <nexus/NeXusException.hpp>
@@ -131,22 +132,48 @@ bool isControlValue(const char &c, const std::string &propName,
   }
 }
 
+/// The times and values of a time series log, as read from the file
+struct TimeSeriesLog {
+  enum class Type { Int, Double, String };
+  std::string name;
+  std::string units;
+  Types::Core::DateAndTime start;
+  /// Times of the values, in seconds from the start
+  std::vector<double> times;
+  Type type = Type::Double;
+  std::vector<int> intValues;
+  std::vector<double> doubleValues;
+  /// All the strings, each padded to itemLength characters
+  std::string stringValues;
+  size_t itemLength = 0;
+
+  /// Memory held by the times and values, in bytes
+  size_t memorySize() const {
+    return times.size() * sizeof(double) + intValues.size() * sizeof(int) +
+           doubleValues.size() * sizeof(double) + stringValues.size();
+  }
+};
+
+/// Memory the logs read but not yet converted may hold, in bytes. Logs are
+/// converted in batches of about this size, to bound the peak memory.
+constexpr size_t MAX_UNCONVERTED_BYTES = 64 * 1024 * 1024;
+
 /**
- * Creates a time series property from the currently opened log entry. It is
- * assumed to
- * have been checked to have a time field and the value entry's name is given
- * as an argument
+ * Reads the times and values of the currently opened log entry, in one call
+ * per dataset. It is assumed to have been checked to have a time field and the
+ * value entry's name is given as an argument
  * @param file :: A reference to the file handle
  * @param propName :: The name of the property
  * @param freqStart :: A string containing the start time of the frequency log
  * on SNAP
  * @param log :: Reference to logger to print out to
- * @returns A pointer to a new property containing the time series
+ * @returns The times and values of the log
  */
-std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
-                                                   const std::string &propName,
-                                                   const std::string &freqStart,
-                                                   Kernel::Logger &log) {
+TimeSeriesLog readTimeSeries(::NeXus::File &file, const std::string &propName,
+                             const std::string &freqStart,
+                             Kernel::Logger &log) {
+  TimeSeriesLog series;
+  series.name = propName;
   file.openData("time");
   //----- Start time is an ISO8601 string date and time. ------
   std::string start;
@@ -167,7 +194,7 @@ std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
   }
 
   // Convert to date and time
-  Types::Core::DateAndTime start_time = Types::Core::DateAndTime(start);
+  series.start = Types::Core::DateAndTime(start);
   std::string time_units;
   file.getAttr("units", time_units);
   if (time_units.compare("second") < 0 && time_units != "s" &&
@@ -177,9 +204,8 @@ std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
     throw ::NeXus::Exception("Unsupported time unit '" + time_units + "'");
   }
   //--- Load the seconds into a double array ---
-  std::vector<double> time_double;
   try {
-    file.getDataCoerce(time_double);
+    file.getDataCoerce(series.times);
   } catch (::NeXus::Exception &e) {
     log.warning() << "Log entry's time field could not be loaded: '" << e.what()
                   << "'.\n";
@@ -192,95 +218,121 @@ std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
   // Convert to seconds if needed
   if (time_units == "minutes") {
     using std::placeholders::_1;
-    std::transform(time_double.begin(), time_double.end(), time_double.begin(),
+    std::transform(series.times.begin(), series.times.end(),
+                   series.times.begin(),
                    std::bind(std::multiplies<double>(), _1, 60.0));
   }
   // Now the values: Could be a string, int or double
   file.openData("value");
   // Get the units of the property
-  std::string value_units;
   try {
-    file.getAttr("units", value_units);
+    file.getAttr("units", series.units);
   } catch (::NeXus::Exception &) {
     // Ignore missing units field.
-    value_units = "";
+    series.units = "";
   }
 
   // Now the actual data
   ::NeXus::Info info = file.getInfo();
   // Check the size
-  if (size_t(info.dims[0]) != time_double.size()) {
+  if (size_t(info.dims[0]) != series.times.size()) {
     file.closeData();
     throw ::NeXus::Exception("Invalid value entry for time series");
   }
-  if (file.isDataInt()) // Int type
-  {
-    std::vector<int> values;
-    try {
-      file.getDataCoerce(values);
-      file.closeData();
-    } catch (::NeXus::Exception &) {
-      file.closeData();
-      throw;
+  try {
+    if (file.isDataInt()) {
+      series.type = TimeSeriesLog::Type::Int;
+      file.getDataCoerce(series.intValues);
+    } else if (info.type == ::NeXus::CHAR) {
+      series.type = TimeSeriesLog::Type::String;
+      series.itemLength = static_cast<size_t>(info.dims[1]);
+      series.stringValues.resize(series.times.size() * series.itemLength);
+      if (!series.stringValues.empty())
+        file.getData(&series.stringValues[0]);
+    } else if (info.type == ::NeXus::FLOAT32 ||
+               info.type == ::NeXus::FLOAT64) {
+      series.type = TimeSeriesLog::Type::Double;
+      file.getDataCoerce(series.doubleValues);
+    } else {
+      throw ::NeXus::Exception(
+          "Invalid value type for time series. Only int, double or strings "
+          "are supported");
     }
-    // Make an int TSP
-    auto tsp = std::make_unique<TimeSeriesProperty<int>>(propName);
-    tsp->create(start_time, time_double, values);
-    tsp->setUnits(value_units);
-    log.debug() << "   done reading \"value\" array\n";
+  } catch (::NeXus::Exception &) {
+    file.closeData();
+    throw;
+  }
+  file.closeData();
+  log.debug() << "   done reading \"value\" array\n";
+  return series;
+}
+
+/**
+ * Creates a time series property from the times and values read from a log
+ * entry. This does not access the file, so may be run in parallel for several
+ * logs.
+ * @param series :: The times and values of the log, which are consumed
+ * @param log :: Reference to logger to print out to
+ * @returns A pointer to a new property containing the time series
+ */
+std::unique_ptr<Kernel::Property> createTimeSeries(TimeSeriesLog &series,
+                                                   Kernel::Logger &log) {
+  switch (series.type) {
+  case TimeSeriesLog::Type::Int: {
+    auto tsp = std::make_unique<TimeSeriesProperty<int>>(series.name);
+    tsp->create(series.start, series.times, series.intValues);
+    tsp->setUnits(series.units);
     return tsp;
-  } else if (info.type == ::NeXus::CHAR) {
-    std::string values;
-    const int64_t item_length = info.dims[1];
-    try {
-      const int64_t nitems = info.dims[0];
-      const int64_t total_length = nitems * item_length;
-      boost::scoped_array<char> val_array(new char[total_length]);
-      file.getData(val_array.get());
-      file.closeData();
-      values = std::string(val_array.get(), total_length);
-    } catch (::NeXus::Exception &) {
-      file.closeData();
-      throw;
-    }
+  }
+  case TimeSeriesLog::Type::String: {
     // The string may contain non-printable (i.e. control) characters, replace
     // these
+    auto &values = series.stringValues;
     std::replace_if(
         values.begin(), values.end(),
-        [&](const char &c) { return isControlValue(c, propName, log); }, ' ');
-    auto tsp = std::make_unique<TimeSeriesProperty<std::string>>(propName);
+        [&](const char &c) { return isControlValue(c, series.name, log); },
+        ' ');
     std::vector<DateAndTime> times;
-    DateAndTime::createVector(start_time, time_double, times);
-    const size_t ntimes = times.size();
-    for (size_t i = 0; i < ntimes; ++i) {
-      std::string value_i =
-          std::string(values.data() + i * item_length, item_length);
-      tsp->addValue(times[i], value_i);
-    }
-    tsp->setUnits(value_units);
-    log.debug() << "   done reading \"value\" array\n";
+    DateAndTime::createVector(series.start, series.times, times);
+    std::vector<std::string> strings;
+    strings.reserve(times.size());
+    for (size_t i = 0; i < times.size(); ++i)
+      strings.emplace_back(values.data() + i * series.itemLength,
+                           series.itemLength);
+    auto tsp = std::make_unique<TimeSeriesProperty<std::string>>(series.name);
+    tsp->create(times, strings);
+    tsp->setUnits(series.units);
     return tsp;
-  } else if (info.type == ::NeXus::FLOAT32 || info.type == ::NeXus::FLOAT64) {
-    std::vector<double> values;
-    try {
-      file.getDataCoerce(values);
-      file.closeData();
-    } catch (::NeXus::Exception &) {
-      file.closeData();
-      throw;
-    }
-    auto tsp = std::make_unique<TimeSeriesProperty<double>>(propName);
-    tsp->create(start_time, time_double, values);
-    tsp->setUnits(value_units);
-    log.debug() << "   done reading \"value\" array\n";
+  }
+  default: {
+    auto tsp = std::make_unique<TimeSeriesProperty<double>>(series.name);
+    tsp->create(series.start, series.times, series.doubleValues);
+    tsp->setUnits(series.units);
     return tsp;
-  } else {
-    throw ::NeXus::Exception(
-        "Invalid value type for time series. Only int, double or strings are "
-        "supported");
+  }
   }
 }
 
+/**
+ * Creates a time series property from the currently opened log entry. It is
+ * assumed to
+ * have been checked to have a time field and the value entry's name is given
+ * as an argument
+ * @param file :: A reference to the file handle
+ * @param propName :: The name of the property
+ * @param freqStart :: A string containing the start time of the frequency log
+ * on SNAP
+ * @param log :: Reference to logger to print out to
+ * @returns A pointer to a new property containing the time series
+ */
+std::unique_ptr<Kernel::Property> createTimeSeries(::NeXus::File &file,
+                                                   const std::string &propName,
+                                                   const std::string &freqStart,
+                                                   Kernel::Logger &log) {
+  auto series = readTimeSeries(file, propName, freqStart, log);
+  return createTimeSeries(series, log);
+}
+
 /**
  * Appends an additional entry to a TimeSeriesProperty which is at the end
  * time of the run and contains the last value of the property recorded before
@@ -357,6 +409,14 @@ void LoadNexusLogs::init() {
   declareProperty(std::make_unique<PropertyWithValue<std::string>>(
                       "NXentryName", "", Direction::Input),
                   "Entry in the nexus file from which to read the logs");
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>("LogAllowList"),
+      "If given, only the logs whose names match one of these patterns are "
+      "loaded. The patterns may contain the wildcards * and ?.");
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>("LogBlockList"),
+      "The logs whose names match one of these patterns are not loaded. The "
+      "patterns may contain the wildcards * and ?.");
 }
 
 /** Executes the algorithm. Reading in the file and creating and populating
@@ -369,6 +429,8 @@ void LoadNexusLogs::init() {
 void LoadNexusLogs::execLoader() {
   std::string filename = getPropertyValue("Filename");
   MatrixWorkspace_sptr workspace = getProperty("Workspace");
+  m_allowList = getProperty("LogAllowList");
+  m_blockList = getProperty("LogBlockList");
 
   std::string entry_name = getPropertyValue("NXentryName");
   // Find the entry name to use (normally "entry" for SNS, "raw_data_1" for
@@ -668,7 +730,11 @@ void LoadNexusLogs::loadNPeriods(
 }
 
 /**
- * Load log entries from the given group
+ * Load log entries from the given group. The time series of the NXlog and
+ * NXpositioner entries are read, each dataset in one call, then made into
+ * properties in parallel, as the file may only be read by one thread. They are
+ * converted in batches, so that at most about MAX_UNCONVERTED_BYTES of read
+ * values are held at once besides the logs.
  * @param file :: A reference to the NeXus file handle opened such that the
  * next call can be to open the named group
  * @param absolute_entry_name :: The name of the log entry
@@ -682,6 +748,39 @@ void LoadNexusLogs::loadLogs(
 
   const std::map<std::string, std::set<std::string>> &allEntries =
       getFileInfo()->getAllEntries();
+  const bool overwritelogs = this->getProperty("OverwriteLogs");
+  std::vector<TimeSeriesLog> timeSeries;
+  size_t unconvertedBytes = 0;
+
+  // Make properties of the logs read so far, in parallel, and add them to the
+  // run in file order
+  auto convertTimeSeries = [&]() {
+    const auto &run = workspace->run();
+    std::vector<std::unique_ptr<Kernel::Property>> logValues(
+        timeSeries.size());
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(timeSeries.size()); ++i) {
+      auto &series = timeSeries[i];
+      try {
+        logValues[i] = createTimeSeries(series, g_log);
+        appendEndTimeLog(logValues[i].get(), run);
+      } catch (std::exception &e) {
+        g_log.warning() << "NXlog entry " << series.name
+                        << " gave an error when loading:'" << e.what()
+                        << "'.\n";
+      }
+      // Release the memory of the values as soon as they are converted
+      series = TimeSeriesLog();
+    }
+    for (auto &logValue : logValues) {
+      if (logValue &&
+          (overwritelogs || !workspace->run().hasProperty(logValue->name())))
+        workspace->mutableRun().addProperty(std::move(logValue),
+                                            overwritelogs);
+    }
+    timeSeries.clear();
+    unconvertedBytes = 0;
+  };
 
   auto lf_LoadByLogClass = [&](const std::string &logClass,
                                const bool isNxLog) {
@@ -697,12 +796,27 @@ void LoadNexusLogs::loadLogs(
          it->compare(0, absolute_entry_name.size(), absolute_entry_name) == 0;
          ++it) {
       // must be third level entry
-      if (std::count(it->begin(), it->end(), '/') == 3) {
-        if (isNxLog) {
-          loadNXLog(file, *it, logClass, workspace);
-        } else {
-          loadSELog(file, *it, workspace);
+      if (std::count(it->begin(), it->end(), '/') != 3)
+        continue;
+      const std::string logName = it->substr(it->find_last_of("/") + 1);
+      if (!isLogWanted(logName))
+        continue;
+      if (!isNxLog) {
+        loadSELog(file, *it, workspace);
+      } else if ((overwritelogs || !workspace->run().hasProperty(logName)) &&
+                 openNXLog(file, *it, logClass)) {
+        try {
+          timeSeries.emplace_back(
+              readTimeSeries(file, logName, freqStart, g_log));
+          unconvertedBytes += timeSeries.back().memorySize();
+        } catch (::NeXus::Exception &e) {
+          g_log.warning() << "NXlog entry " << logName
+                          << " gave an error when loading:'" << e.what()
+                          << "'.\n";
         }
+        file.closeGroup();
+        if (unconvertedBytes >= MAX_UNCONVERTED_BYTES)
+          convertTimeSeries();
       }
     }
   };
@@ -712,6 +826,8 @@ void LoadNexusLogs::loadLogs(
   file.openGroup(entry_name, entry_class);
   lf_LoadByLogClass("NXlog", true);
   lf_LoadByLogClass("NXpositioner", true);
+  convertTimeSeries();
+
   lf_LoadByLogClass("IXseblock", false);
   loadVetoPulses(file, workspace);
 
@@ -719,22 +835,20 @@ void LoadNexusLogs::loadLogs(
 }
 
 /**
- * Load an NX log entry a group type that has value and time entries.
+ * Open an NX log entry, a group type that has value and time entries.
  * @param file :: A reference to the NeXus file handle opened at the parent
  * group
  * @param absolute_entry_name :: The name of the log entry
  * @param entry_class :: The type of the entry
- * @param workspace :: A pointer to the workspace to store the logs
+ * @return True if the entry was opened, false if it is not a valid entry
  */
-void LoadNexusLogs::loadNXLog(
-    ::NeXus::File &file, const std::string &absolute_entry_name,
-    const std::string &entry_class,
-    const std::shared_ptr<API::MatrixWorkspace> &workspace) const {
+bool LoadNexusLogs::openNXLog(::NeXus::File &file,
+                              const std::string &absolute_entry_name,
+                              const std::string &entry_class) const {
 
   const std::string entry_name =
       absolute_entry_name.substr(absolute_entry_name.find_last_of("/") + 1);
   g_log.debug() << "processing " << entry_name << ":" << entry_class << "\n";
-  file.openGroup(entry_name, entry_class);
   // Validate the NX log class.
   // Just verify that time and value entries exist
   const std::string timeEntry = absolute_entry_name + "/time";
@@ -761,24 +875,21 @@ void LoadNexusLogs::loadNXLog(
   if (!foundTime || !foundValue) {
     g_log.warning() << "Invalid NXlog entry " << entry_name
                     << " found. Did not contain 'value' and 'time'.\n";
-    file.closeGroup();
-    return;
-  }
-
-  // whether or not to overwrite logs on workspace
-  bool overwritelogs = this->getProperty("OverwriteLogs");
-  try {
-    if (overwritelogs || !(workspace->run().hasProperty(entry_name))) {
-      auto logValue = createTimeSeries(file, entry_name, freqStart, g_log);
-      appendEndTimeLog(logValue.get(), workspace->run());
-      workspace->mutableRun().addProperty(std::move(logValue), overwritelogs);
-    }
-  } catch (::NeXus::Exception &e) {
-    g_log.warning() << "NXlog entry " << entry_name
-                    << " gave an error when loading:'" << e.what() << "'.\n";
+    return false;
   }
+  file.openGroup(entry_name, entry_class);
+  return true;
+}
 
-  file.closeGroup();
+/**
+ * Whether a log is to be loaded, from the LogAllowList and LogBlockList. The
+ * proton charge logs and period_log are always loaded, as the event loaders
+ * rely on them.
+ * @param logName :: The name of the log entry
+ * @return True if the log is to be loaded
+ */
+bool LoadNexusLogs::isLogWanted(const std::string &logName) const {
+  return API::Run::isLogSelected(logName, m_allowList, m_blockList);
 }
 
 void LoadNexusLogs::loadSELog(
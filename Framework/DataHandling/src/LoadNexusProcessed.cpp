@@ -62,6 +62,55 @@ namespace {
 // Helper typedef
 using IntArray = std::vector<int>;
 
+/// Number of values read at once from each field of a histogram workspace
+constexpr int BLOCK_VALUES = 1 << 20;
+/// Smallest number of spectra read at once from a histogram workspace
+constexpr int MIN_BLOCK_SPECTRA = 8;
+
+/** Group the spectra to load into runs of consecutive spectra, each of which
+ * can be read at once.
+ * @param spectrumNumbers :: the spectra to load, from 1, in workspace order
+ * @return the index in the file of the first spectrum and the number of
+ * spectra of each run
+ */
+std::vector<std::pair<int, int>>
+consecutiveSpectra(const std::vector<int> &spectrumNumbers) {
+  std::vector<std::pair<int, int>> runs;
+  for (const int spectrum : spectrumNumbers) {
+    if (!runs.empty() &&
+        runs.back().first + runs.back().second == spectrum - 1)
+      ++runs.back().second;
+    else
+      runs.emplace_back(spectrum - 1, 1);
+  }
+  return runs;
+}
+
+/** Read the parts of an event field spanned by runs of consecutive spectra
+ * @param field :: the field, of all the events in the file
+ * @param ranges :: first and last+1 event of each run
+ * @return the events of the runs, one after the other
+ */
+template <typename T>
+std::vector<T>
+loadEventRanges(NXDataSetTyped<T> &field,
+                const std::vector<std::pair<int64_t, int64_t>> &ranges) {
+  if (ranges.size() == 1 && ranges.front().first == 0 &&
+      ranges.front().second == field.dim0()) {
+    field.load();
+    return field.vecBuffer();
+  }
+  std::vector<T> values;
+  for (const auto &range : ranges) {
+    const auto count = static_cast<int>(range.second - range.first);
+    if (count <= 0)
+      continue;
+    field.load(count, static_cast<int>(range.first));
+    values.insert(values.end(), field(), field() + count);
+  }
+  return values;
+}
+
 // Struct to contain spectrum information.
 struct SpectraInfo {
   // Number of spectra
@@ -241,6 +290,14 @@ void LoadNexusProcessed::init() {
                   "one workspace");
   declareProperty("LoadHistory", true,
                   "If true, the workspace history will be loaded");
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>("LogAllowList"),
+      "If given, only the sample logs whose names match one of these "
+      "patterns are loaded. The patterns may contain the wildcards * and ?.");
+  declareProperty(
+      std::make_unique<ArrayProperty<std::string>>("LogBlockList"),
+      "The sample logs whose names match one of these patterns are not "
+      "loaded. The patterns may contain the wildcards * and ?.");
   declareProperty(
       std::make_unique<PropertyWithValue<bool>>("FastMultiPeriod", true,
                                                 Direction::Input),
@@ -362,7 +419,9 @@ Workspace_sptr LoadNexusProcessed::doAccelleratedMultiPeriodLoading(
 
   try {
     // This loads logs, sample, and instrument.
-    periodWorkspace->loadSampleAndLogInfoNexus(m_nexusFile.get());
+    periodWorkspace->loadSampleAndLogInfoNexus(
+        m_nexusFile.get(), getProperty("LogAllowList"),
+        getProperty("LogBlockList"));
   } catch (std::exception &e) {
     g_log.information("Error loading Instrument section of nxs file");
     g_log.information(e.what());
@@ -686,35 +745,47 @@ LoadNexusProcessed::loadEventEntry(NXData &wksp_cls, NXDouble &xbins,
     unitLabel = indices_data.attributes("units");
   ws->setYUnitLabel(unitLabel);
 
+  // Only read the events of the spectra to load, a run of consecutive
+  // spectra at a time
+  std::vector<int64_t> indices = indices_data.vecBuffer();
+  std::vector<std::pair<int64_t, int64_t>> ranges;
+  // Where the events of each spectrum to load start in the fields read
+  std::vector<int64_t> starts(m_filtered_spec_idxs.size());
+  int64_t numEvents = 0;
+  auto start = starts.begin();
+  for (const auto &run : consecutiveSpectra(m_filtered_spec_idxs)) {
+    ranges.emplace_back(indices[run.first], indices[run.first + run.second]);
+    for (int wi = run.first; wi < run.first + run.second; ++wi, ++start)
+      *start = numEvents + indices[wi] - ranges.back().first;
+    numEvents +=
+        std::max(int64_t(0), ranges.back().second - ranges.back().first);
+  }
+
   // Handle optional fields.
   // TODO: Handle inconsistent sizes
   std::vector<int64_t> pulsetimes;
   if (wksp_cls.isValid("pulsetime")) {
     NXDataSetTyped<int64_t> pulsetime =
         wksp_cls.openNXDataSet<int64_t>("pulsetime");
-    pulsetime.load();
-    pulsetimes = pulsetime.vecBuffer();
+    pulsetimes = loadEventRanges(pulsetime, ranges);
   }
 
   std::vector<double> tofs;
   if (wksp_cls.isValid("tof")) {
     NXDouble tof = wksp_cls.openNXDouble("tof");
-    tof.load();
-    tofs = tof.vecBuffer();
+    tofs = loadEventRanges(tof, ranges);
   }
 
   std::vector<float> error_squareds;
   if (wksp_cls.isValid("error_squared")) {
     NXFloat error_squared = wksp_cls.openNXFloat("error_squared");
-    error_squared.load();
-    error_squareds = error_squared.vecBuffer();
+    error_squareds = loadEventRanges(error_squared, ranges);
   }
 
   std::vector<float> weights;
   if (wksp_cls.isValid("weight")) {
     NXFloat weight = wksp_cls.openNXFloat("weight");
-    weight.load();
-    weights = weight.vecBuffer();
+    weights = loadEventRanges(weight, ranges);
   }
 
   // What type of event lists?
@@ -729,8 +800,6 @@ LoadNexusProcessed::loadEventEntry(NXData &wksp_cls, NXDouble &xbins,
   else
     throw std::runtime_error("Could not figure out the type of event list!");
 
-  // indices of events
-  std::vector<int64_t> indices = indices_data.vecBuffer();
   // Create all the event lists
   auto max = static_cast<int64_t>(m_filtered_spec_idxs.size());
   Progress progress(this, progressStart, progressStart + progressRange, max);
@@ -738,8 +807,8 @@ LoadNexusProcessed::loadEventEntry(NXData &wksp_cls, NXDouble &xbins,
   for (int64_t j = 0; j < max; ++j) {
     PARALLEL_START_INTERUPT_REGION
     size_t wi = m_filtered_spec_idxs[j] - 1;
-    int64_t index_start = indices[wi];
-    int64_t index_end = indices[wi + 1];
+    int64_t index_start = starts[j];
+    int64_t index_end = starts[j] + indices[wi + 1] - indices[wi];
     if (index_end >= index_start) {
       EventList &el = ws->getSpectrum(j);
       el.switchTo(type);
@@ -1270,7 +1339,7 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
   checkOptionalProperties(nspectra);
   // Actual number of spectra in output workspace (if only a range was going
   // to be loaded)
-  size_t total_specs = calculateWorkspaceSize(nspectra);
+  size_t total_specs = calculateWorkspaceSize(nspectra, true);
 
   //// Create the 2D workspace for the output
   bool hasFracArea = false;
@@ -1328,136 +1397,27 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(
                          "last value will be dropped.\n";
   }
 
-  int blocksize = 8;
-  // const int fullblocks = nspectra / blocksize;
-  // size of the workspace
-  // have to cast down to int as later functions require ints
-  int fullblocks = static_cast<int>(total_specs) / blocksize;
-  int read_stop = (fullblocks * blocksize);
+  // Read runs of consecutive spectra in blocks of about BLOCK_VALUES values
+  const int blocksize =
+      std::max(MIN_BLOCK_SPECTRA, BLOCK_VALUES / std::max(1, nchannels));
   const double progressBegin = progressStart + 0.25 * progressRange;
   const double progressScaler = 0.75 * progressRange;
-  int hist_index = 0;
   int wsIndex = 0;
-  if (m_shared_bins) {
-    // if spectrum min,max,list properties are set
-    if (m_interval || m_list) {
-      // if spectrum max,min properties are set read the data as a
-      // block(multiple of 8) and
-      // then read the remaining data as finalblock
-      if (m_interval) {
-        // specs at the min-max interval
-        int interval_specs = m_spec_max - m_spec_min;
-        fullblocks = (interval_specs) / blocksize;
-        read_stop = (fullblocks * blocksize) + m_spec_min - 1;
-
-        if (interval_specs < blocksize) {
-          blocksize = static_cast<int>(total_specs);
-          read_stop = m_spec_max - 1;
-        }
-        hist_index = m_spec_min - 1;
-
-        for (; hist_index < read_stop;) {
-          progress(progressBegin + progressScaler *
-                                       static_cast<double>(hist_index) /
-                                       static_cast<double>(read_stop),
-                   "Reading workspace data...");
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    blocksize, nchannels, hist_index, wsIndex, local_workspace);
-        }
-        size_t finalblock = m_spec_max - 1 - read_stop;
-        if (finalblock > 0) {
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    static_cast<int>(finalblock), nchannels, hist_index,
-                    wsIndex, local_workspace);
-        }
-      }
-      // if spectrum list property is set read each spectrum separately by
-      // setting blocksize=1
-      if (m_list) {
-        for (const auto itr : m_spec_list) {
-          int specIndex = itr - 1;
-          progress(progressBegin + progressScaler *
-                                       static_cast<double>(specIndex) /
-                                       static_cast<double>(m_spec_list.size()),
-                   "Reading workspace data...");
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors, 1,
-                    nchannels, specIndex, wsIndex, local_workspace);
-        }
-      }
-    } else {
-      for (; hist_index < read_stop;) {
-        progress(progressBegin + progressScaler *
-                                     static_cast<double>(hist_index) /
-                                     static_cast<double>(read_stop),
-                 "Reading workspace data...");
+  for (const auto &run : consecutiveSpectra(m_filtered_spec_idxs)) {
+    int hist_index = run.first;
+    const int read_stop = run.first + run.second;
+    while (hist_index < read_stop) {
+      progress(progressBegin + progressScaler * static_cast<double>(wsIndex) /
+                                   static_cast<double>(total_specs),
+               "Reading workspace data...");
+      const int block = std::min(blocksize, read_stop - hist_index);
+      if (m_shared_bins)
         loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                  blocksize, nchannels, hist_index, wsIndex, local_workspace);
-      }
-      size_t finalblock = total_specs - read_stop;
-      if (finalblock > 0) {
+                  block, nchannels, hist_index, wsIndex, local_workspace);
+      else
         loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                  static_cast<int>(finalblock), nchannels, hist_index, wsIndex,
+                  xbins, block, nchannels, hist_index, wsIndex,
                   local_workspace);
-      }
-    }
-
-  } else {
-    if (m_interval || m_list) {
-      if (m_interval) {
-        int interval_specs = m_spec_max - m_spec_min;
-        fullblocks = (interval_specs) / blocksize;
-        read_stop = (fullblocks * blocksize) + m_spec_min - 1;
-
-        if (interval_specs < blocksize) {
-          blocksize = interval_specs;
-          read_stop = m_spec_max - 1;
-        }
-        hist_index = m_spec_min - 1;
-
-        for (; hist_index < read_stop;) {
-          progress(progressBegin + progressScaler *
-                                       static_cast<double>(hist_index) /
-                                       static_cast<double>(read_stop),
-                   "Reading workspace data...");
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    xbins, blocksize, nchannels, hist_index, wsIndex,
-                    local_workspace);
-        }
-        size_t finalblock = m_spec_max - 1 - read_stop;
-        if (finalblock > 0) {
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    xbins, static_cast<int>(finalblock), nchannels, hist_index,
-                    wsIndex, local_workspace);
-        }
-      }
-      //
-      if (m_list) {
-        for (const auto itr : m_spec_list) {
-          int specIndex = itr - 1;
-          progress(progressBegin + progressScaler *
-                                       static_cast<double>(specIndex) /
-                                       static_cast<double>(read_stop),
-                   "Reading workspace data...");
-          loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                    xbins, 1, nchannels, specIndex, wsIndex, local_workspace);
-        }
-      }
-    } else {
-      for (; hist_index < read_stop;) {
-        progress(progressBegin + progressScaler *
-                                     static_cast<double>(hist_index) /
-                                     static_cast<double>(read_stop),
-                 "Reading workspace data...");
-        loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                  xbins, blocksize, nchannels, hist_index, wsIndex,
-                  local_workspace);
-      }
-      size_t finalblock = total_specs - read_stop;
-      if (finalblock > 0) {
-        loadBlock(data, errors, fracarea, hasFracArea, xErrors, hasXErrors,
-                  xbins, static_cast<int>(finalblock), nchannels, hist_index,
-                  wsIndex, local_workspace);
-      }
     }
   }
   return local_workspace;
@@ -1613,8 +1573,9 @@ API::Workspace_sptr LoadNexusProcessed::loadEntry(NXRoot &root,
   try {
     // This loads logs, sample, and instrument.
     local_workspace->loadExperimentInfoNexus(
-        getPropertyValue("Filename"), m_nexusFile.get(),
-        parameterStr); // REQUIRED PER PERIOD
+        getPropertyValue("Filename"), m_nexusFile.get(), parameterStr,
+        getProperty("LogAllowList"),
+        getProperty("LogBlockList")); // REQUIRED PER PERIOD
 
     // Parameter map parsing only if instrument loaded OK.
     progress(progressStart + 0.11 * progressRange,
@@ -1883,85 +1844,6 @@ void LoadNexusProcessed::readBinMasking(
   }
 }
 
-/**
- * Perform a call to nxgetslab, via the NexusClasses wrapped methods for a
- * given
- * blocksize. This assumes that the
- * xbins have alread been cached
- * @param data :: The NXDataSet object of y values
- * @param errors :: The NXDataSet object of error values
- * @param farea :: The NXDataSet object of fraction area values
- * @param hasFArea :: Flag to signal a RebinnedOutput workspace is in use
- * @param xErrors :: The NXDataSet object of xError values
- * @param hasXErrors :: Flag to signal the File contains x errors
- * @param blocksize :: The blocksize to use
- * @param nchannels :: The number of channels for the block
- * @param hist :: The workspace index to start reading into
- * @param local_workspace :: A pointer to the workspace
- */
-void LoadNexusProcessed::loadBlock(
-    NXDataSetTyped<double> &data, NXDataSetTyped<double> &errors,
-    NXDataSetTyped<double> &farea, bool hasFArea, NXDouble &xErrors,
-    bool hasXErrors, int blocksize, int nchannels, int &hist,
-    const API::MatrixWorkspace_sptr &local_workspace) {
-  data.load(blocksize, hist);
-  errors.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
-  size_t dx_increment = nchannels;
-  // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
-  // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
-  // otherwise nchannels. See #16298.
-  // WARNING: We are dropping the last Dx value for old files!
-  size_t dx_input_increment = xErrors.dim1();
-  RebinnedOutput_sptr rb_workspace;
-  if (hasFArea) {
-    farea.load(blocksize, hist);
-    farea_start = farea();
-    farea_end = farea_start + nchannels;
-    rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
-  }
-  if (hasXErrors) {
-    xErrors.load(blocksize, hist);
-    xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
-  }
-
-  int final(hist + blocksize);
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(hist);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(hist);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
-    if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(hist);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
-    }
-    if (hasXErrors) {
-      local_workspace->setSharedDx(
-          hist, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                             xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
-    }
-
-    local_workspace->setSharedX(hist, m_xbins.cowData());
-    ++hist;
-  }
-}
-
 /**
  * Perform a call to nxgetslab, via the NexusClasses wrapped methods for a
  * given
@@ -1987,14 +1869,10 @@ void LoadNexusProcessed::loadBlock(
     const API::MatrixWorkspace_sptr &local_workspace) {
   data.load(blocksize, hist);
   errors.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
+  const double *data_start = data();
+  const double *err_start = errors();
+  const double *farea_start = nullptr;
+  const double *xErrors_start = nullptr;
   size_t dx_increment = nchannels;
   // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
   // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
@@ -2005,42 +1883,36 @@ void LoadNexusProcessed::loadBlock(
   if (hasFArea) {
     farea.load(blocksize, hist);
     farea_start = farea();
-    farea_end = farea_start + nchannels;
     rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
   }
   if (hasXErrors) {
     xErrors.load(blocksize, hist);
     xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
-  }
-
-  int final(hist + blocksize);
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(wsIndex);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(wsIndex);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
+  }
+
+  // The block is read, now fill its histograms in parallel
+  PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+  for (int i = 0; i < blocksize; ++i) {
+    const auto index = static_cast<size_t>(wsIndex + i);
+    const size_t offset = static_cast<size_t>(i) * nchannels;
+    local_workspace->mutableY(index).assign(data_start + offset,
+                                            data_start + offset + nchannels);
+    local_workspace->mutableE(index).assign(err_start + offset,
+                                            err_start + offset + nchannels);
     if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(wsIndex);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
+      rb_workspace->dataF(index).assign(farea_start + offset,
+                                        farea_start + offset + nchannels);
     }
     if (hasXErrors) {
+      const auto dx_start = xErrors_start + i * dx_input_increment;
       local_workspace->setSharedDx(
-          wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                                xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
+          index, Kernel::make_cow<HistogramData::HistogramDx>(
+                     dx_start, dx_start + dx_increment));
     }
-    local_workspace->setSharedX(wsIndex, m_xbins.cowData());
-    ++hist;
-    ++wsIndex;
+    local_workspace->setSharedX(index, m_xbins.cowData());
   }
+  hist += blocksize;
+  wsIndex += blocksize;
 }
 
 /**
@@ -2067,15 +1939,11 @@ void LoadNexusProcessed::loadBlock(
     bool hasXErrors, NXDouble &xbins, int blocksize, int nchannels, int &hist,
     int &wsIndex, const API::MatrixWorkspace_sptr &local_workspace) {
   data.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
+  const double *data_start = data();
   errors.load(blocksize, hist);
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
+  const double *err_start = errors();
+  const double *farea_start = nullptr;
+  const double *xErrors_start = nullptr;
   size_t dx_increment = nchannels;
   // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
   // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
@@ -2086,50 +1954,41 @@ void LoadNexusProcessed::loadBlock(
   if (hasFArea) {
     farea.load(blocksize, hist);
     farea_start = farea();
-    farea_end = farea_start + nchannels;
     rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
   }
   xbins.load(blocksize, hist);
   const int nxbins(xbins.dim1());
-  double *xbin_start = xbins();
-  double *xbin_end = xbin_start + nxbins;
-  int final(hist + blocksize);
+  const double *xbin_start = xbins();
 
   if (hasXErrors) {
     xErrors.load(blocksize, hist);
     xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
-  }
-
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(wsIndex);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(wsIndex);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
+  }
+
+  // The block is read, now fill its histograms in parallel
+  PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+  for (int i = 0; i < blocksize; ++i) {
+    const auto index = static_cast<size_t>(wsIndex + i);
+    const size_t offset = static_cast<size_t>(i) * nchannels;
+    local_workspace->mutableY(index).assign(data_start + offset,
+                                            data_start + offset + nchannels);
+    local_workspace->mutableE(index).assign(err_start + offset,
+                                            err_start + offset + nchannels);
     if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(wsIndex);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
+      rb_workspace->dataF(index).assign(farea_start + offset,
+                                        farea_start + offset + nchannels);
     }
     if (hasXErrors) {
+      const auto dx_start = xErrors_start + i * dx_input_increment;
       local_workspace->setSharedDx(
-          wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start,
-                                                                xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
+          index, Kernel::make_cow<HistogramData::HistogramDx>(
+                     dx_start, dx_start + dx_increment));
     }
-    auto &X = local_workspace->mutableX(wsIndex);
-    X.assign(xbin_start, xbin_end);
-    xbin_start += nxbins;
-    xbin_end += nxbins;
-    ++hist;
-    ++wsIndex;
+    const auto x_start = xbin_start + static_cast<size_t>(i) * nxbins;
+    local_workspace->mutableX(index).assign(x_start, x_start + nxbins);
   }
+  hist += blocksize;
+  wsIndex += blocksize;
 }
 
 /**
@@ -2197,6 +2056,8 @@ LoadNexusProcessed::calculateWorkspaceSize(const std::size_t numberofspectra,
                                            bool gen_filtered_list) {
   // Calculate the size of a workspace, given its number of spectra to read
   size_t total_specs;
+  if (gen_filtered_list)
+    m_filtered_spec_idxs.clear();
   if (m_interval || m_list) {
     if (m_interval) {
       if (m_spec_min != 1 && m_spec_max == 1) {
@@ -90,6 +90,30 @@ getResultVector(DataObjects::EventWorkspace &ws) {
   return eventLists;
 }
 
+/// Return the event lists of the workspace in the order of the non-monitor
+/// detectors, which is the global index used by bankOffsets. Detectors without
+/// a spectrum in the workspace, e.g. outside of a spectrum selection, get no
+/// event list and their events are dropped.
+std::vector<std::vector<Types::Event::TofEvent> *>
+getResultVectorByDetector(DataObjects::EventWorkspace &ws) {
+  const auto &detInfo = ws.detectorInfo();
+  const auto &detIds = detInfo.detectorIDs();
+  const auto detIdToIndex = ws.getDetectorIDToWorkspaceIndexMap();
+
+  std::vector<std::vector<Types::Event::TofEvent> *> eventLists;
+  eventLists.reserve(detInfo.size());
+  for (size_t i = 0; i < detInfo.size(); ++i) {
+    if (detInfo.isMonitor(i))
+      continue;
+    std::vector<Types::Event::TofEvent> *events{nullptr};
+    const auto index = detIdToIndex.find(detIds[i]);
+    if (index != detIdToIndex.end())
+      getEventsFrom(ws.getSpectrum(index->second), events);
+    eventLists.emplace_back(events);
+  }
+  return eventLists;
+}
+
 std::vector<int32_t> getOffsets(const DataObjects::EventWorkspace &ws,
                                 const std::string &filename,
                                 const std::string &groupName,
@@ -118,16 +142,19 @@ void ParallelEventLoader::loadMPI(DataObjects::EventWorkspace &ws,
 }
 
 /// Load events from given banks into given EventWorkspace using
-/// boost::interprocess.
+/// boost::interprocess. Only the events accepted by the filter are loaded.
 void ParallelEventLoader::loadMultiProcess(
     DataObjects::EventWorkspace &ws, const std::string &filename,
     const std::string &groupName, const std::vector<std::string> &bankNames,
-    const bool eventIDIsSpectrumNumber, const bool precalcEvents) {
-  auto eventLists = getResultVector(ws);
+    const bool eventIDIsSpectrumNumber, const bool precalcEvents,
+    const Parallel::IO::EventFilter &filter) {
+  auto eventLists = eventIDIsSpectrumNumber ? getResultVector(ws)
+                                            : getResultVectorByDetector(ws);
   std::vector<int32_t> offsets =
       getOffsets(ws, filename, groupName, bankNames, eventIDIsSpectrumNumber);
   Parallel::IO::EventLoader::load(filename, groupName, bankNames, offsets,
-                                  std::move(eventLists), precalcEvents);
+                                  std::move(eventLists), precalcEvents,
+                                  filter);
 }
 
 } // namespace DataHandling
@@ -4,6 +4,8 @@
 //   NScD Oak Ridge National Laboratory, European Spallation Source,
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include "MantidDataHandling/DefaultEventLoader.h"
@@ -62,12 +64,179 @@ getPulseIndex(const size_t event_index, const size_t last_pulse_index,
   }
   return std::distance(event_index_vec->cbegin(), event_index_iter);
 }
+
+/// Normalization of the TOF of an event in the average TOF of a compressed
+/// event, as in EventList::compressEvents
+inline double calcNorm(const double errorSquared) {
+  if (errorSquared == 0.)
+    return 0;
+  else if (errorSquared == 1.)
+    return 1.;
+  else
+    return 1. / std::sqrt(errorSquared);
+}
+
+/** Accumulates the events of many event lists into time-of-flight bins of
+ * constant width as they are read, so that memory grows with the number of
+ * occupied bins rather than with the number of events.
+ *
+ * Events are buffered, then sorted and merged into the bins of their list in
+ * batches. A batch is at least as large as the number of bins held so far so
+ * that the cost of merging stays proportional to the number of events.
+ */
+class LinearEventCompressor {
+public:
+  LinearEventCompressor(const size_t numLists, const double binWidth)
+      : m_bins(numLists), m_inverseWidth(1. / binWidth), m_numBins(0) {}
+
+  /// Add an event with the given weight to an event list
+  void add(const size_t list, const double tof, const double weight) {
+    m_buffer.push_back({list, tof, weight});
+    if (m_buffer.size() >= std::max(MIN_BATCH_SIZE, m_numBins))
+      flush();
+  }
+
+  /// True if no event was added to the event list
+  bool empty(const size_t list) const { return m_bins[list].empty(); }
+
+  /** Move the compressed events of an event list to the end of a vector.
+   * flush() must be called first.
+   * @param list :: the event list
+   * @param out :: receives the compressed events, sorted by TOF
+   */
+  void moveTo(const size_t list, std::vector<WeightedEventNoTime> &out) {
+    auto &bins = m_bins[list];
+    out.reserve(out.size() + bins.size());
+    for (const auto &bin : bins) {
+      // A single event keeps its exact TOF
+      const double tof = bin.count == 1 || bin.normalization == 0.
+                             ? bin.firstTof
+                             : bin.tofSum / bin.normalization;
+      out.emplace_back(tof, bin.weight, bin.errorSquared);
+    }
+    m_numBins -= bins.size();
+    std::vector<Bin>().swap(bins);
+  }
+
+  /// Merge the buffered events into the bins of their event list
+  void flush() {
+    std::sort(m_buffer.begin(), m_buffer.end(),
+              [](const Event &lhs, const Event &rhs) {
+                return lhs.list < rhs.list ||
+                       (lhs.list == rhs.list && lhs.tof < rhs.tof);
+              });
+    std::vector<Bin> added;
+    for (auto first = m_buffer.cbegin(); first != m_buffer.cend();) {
+      const auto list = first->list;
+      added.clear();
+      for (; first != m_buffer.cend() && first->list == list; ++first) {
+        const auto index = static_cast<int64_t>(
+            std::floor(first->tof * m_inverseWidth));
+        if (added.empty() || added.back().index != index)
+          added.push_back({index, first->tof, 0., 0., 0., 0., 0});
+        auto &bin = added.back();
+        const double errorSquared = first->weight * first->weight;
+        const double norm = calcNorm(errorSquared);
+        bin.tofSum += first->tof * norm;
+        bin.normalization += norm;
+        bin.weight += first->weight;
+        bin.errorSquared += errorSquared;
+        ++bin.count;
+      }
+      merge(m_bins[list], added);
+    }
+    m_buffer.clear();
+  }
+
+private:
+  /// An event waiting to be compressed
+  struct Event {
+    size_t list;
+    double tof;
+    double weight;
+  };
+  /// The events of an event list falling in one bin
+  struct Bin {
+    int64_t index;
+    double firstTof;
+    double tofSum;
+    double normalization;
+    double weight;
+    double errorSquared;
+    size_t count;
+  };
+
+  /// Merge bins sorted by index into the (sorted) bins of an event list
+  void merge(std::vector<Bin> &bins, const std::vector<Bin> &added) {
+    const auto numBins = bins.size();
+    if (bins.empty()) {
+      bins = added;
+    } else {
+      std::vector<Bin> merged;
+      merged.reserve(bins.size() + added.size());
+      auto lhs = bins.cbegin();
+      auto rhs = added.cbegin();
+      while (lhs != bins.cend() || rhs != added.cend()) {
+        if (rhs == added.cend() ||
+            (lhs != bins.cend() && lhs->index < rhs->index)) {
+          merged.emplace_back(*lhs++);
+        } else if (lhs == bins.cend() || rhs->index < lhs->index) {
+          merged.emplace_back(*rhs++);
+        } else {
+          merged.emplace_back(*lhs++);
+          auto &bin = merged.back();
+          bin.tofSum += rhs->tofSum;
+          bin.normalization += rhs->normalization;
+          bin.weight += rhs->weight;
+          bin.errorSquared += rhs->errorSquared;
+          bin.count += rhs->count;
+          ++rhs;
+        }
+      }
+      bins.swap(merged);
+    }
+    m_numBins += bins.size() - numBins;
+  }
+
+  /// Smallest number of events buffered before merging them into the bins
+  static constexpr size_t MIN_BATCH_SIZE = 1 << 16;
+
+  /// Bins of each event list, sorted by index
+  std::vector<std::vector<Bin>> m_bins;
+  /// Events waiting to be merged into the bins
+  std::vector<Event> m_buffer;
+  /// Inverse of the width of a bin
+  double m_inverseWidth;
+  /// Total number of bins held
+  size_t m_numBins;
+};
 } // namespace
 
+/** Call a function on the event lists of all the pixels of the bank, in all
+ * the periods
+ * @param func :: the function to call with each event list
+ */
+template <class Func> void ProcessBankData::forEachEventList(const Func &func) {
+  auto &outputWS = m_loader.m_ws;
+  const auto numEventLists = outputWS.getNumberHistograms();
+  const auto numPixelIDs = static_cast<detid_t>(pixelID_to_wi_vector.size());
+  for (detid_t pixID = m_min_id; pixID <= m_max_id; ++pixID) {
+    const detid_t offset_pixID = pixID + pixelID_to_wi_offset;
+    if (offset_pixID < 0 || offset_pixID >= numPixelIDs)
+      continue;
+    const auto wi = pixelID_to_wi_vector[offset_pixID];
+    if (wi >= numEventLists)
+      continue;
+    for (size_t period = 0; period < outputWS.nPeriods(); ++period)
+      func(outputWS.getSpectrum(wi, period));
+  }
+}
+
 /** Run the data processing
  * FIXME/TODO - split run() into readable methods
  */
 void ProcessBankData::run() { // override {
+  Kernel::Timer timer;
   // Local tof limits
   double my_shortest_tof =
       static_cast<double>(std::numeric_limits<uint32_t>::max()) * 0.1;
@@ -80,7 +249,12 @@ void ProcessBankData::run() { // override {
   // ---- Pre-counting events per pixel ID ----
   auto &outputWS = m_loader.m_ws;
   auto *alg = m_loader.alg;
-  if (m_loader.precount) {
+  // The events are appended directly to the event vectors, so the lists must
+  // not be compact, which they could be if another bank has the same pixels
+  if (alg->compactEvents)
+    forEachEventList([](EventList &el) { el.unpackColumns(); });
+  // Events compressed while reading never go into the event vectors
+  if (m_loader.precount && !alg->compressWhileReading) {
 
     std::vector<size_t> counts(m_max_id - m_min_id + 1, 0);
     for (size_t i = 0; i < numEvents; i++) {
@@ -130,6 +304,13 @@ void ProcessBankData::run() { // override {
   if (compress)
     usedDetIds.assign(m_max_id - m_min_id + 1, false);
 
+  // Events compressed while reading go to one list per period and detector ID
+  const auto numDetIds = static_cast<size_t>(m_max_id - m_min_id + 1);
+  std::unique_ptr<LinearEventCompressor> compressor;
+  if (alg->compressWhileReading)
+    compressor = std::make_unique<LinearEventCompressor>(
+        outputWS.nPeriods() * numDetIds, alg->compressTolerance);
+
   const double TOF_MIN = alg->filter_tof_min;
   const double TOF_MAX = alg->filter_tof_max;
 
@@ -168,8 +349,25 @@ void ProcessBankData::run() { // override {
             static_cast<double>((*event_time_of_flight)[eventIndex]);
         // this is fancy for check if value is in range
         if ((tof - TOF_MIN) * (tof - TOF_MAX) <= 0.) {
-          // Handle simulated data if present
-          if (have_weight) {
+          if (compressor) {
+            // NULL event vector indicates a bad spectrum lookup
+            const bool validLookup =
+                have_weight
+                    ? m_loader.weightedEventVectors[periodIndex][detId] !=
+                          nullptr
+                    : m_loader.eventVectors[periodIndex][detId] != nullptr;
+            if (validLookup) {
+              const auto weight =
+                  have_weight ? static_cast<double>((*event_weight)[eventIndex])
+                              : 1.;
+              compressor->add(static_cast<size_t>(periodIndex) * numDetIds +
+                                  static_cast<size_t>(detId - m_min_id),
+                              tof, weight);
+            } else {
+              ++my_discarded_events;
+            }
+          } else if (have_weight) {
+            // Handle simulated data if present
             auto *eventVector =
                 m_loader.weightedEventVectors[periodIndex][detId];
             // NULL eventVector indicates a bad spectrum lookup
@@ -224,8 +422,25 @@ void ProcessBankData::run() { // override {
   }
 
   //------------ Compress Events (or set sort order) ------------------
-  // Do it on all the detector IDs we touched
-  if (compress) {
+  if (compressor) {
+    // Move the compressed events to the event lists
+    compressor->flush();
+    for (size_t period = 0; period < outputWS.nPeriods(); ++period) {
+      for (detid_t pixID = m_min_id; pixID <= m_max_id; ++pixID) {
+        const auto list = period * numDetIds + (pixID - m_min_id);
+        if (compressor->empty(list))
+          continue;
+        auto &el = outputWS.getSpectrum(getWorkspaceIndexFromPixelID(pixID),
+                                        period);
+        const bool sorted = el.empty();
+        el.switchTo(API::WEIGHTED_NOTIME);
+        compressor->moveTo(list, el.getWeightedEventsNoTime());
+        el.setSortOrder(sorted ? DataObjects::TOF_SORT
+                               : DataObjects::UNSORTED);
+      }
+    }
+  } else if (compress) {
+    // Do it on all the detector IDs we touched
     for (detid_t pixID = m_min_id; pixID <= m_max_id; ++pixID) {
       if (usedDetIds[pixID - m_min_id]) {
         // Find the the workspace index corresponding to that pixel ID
@@ -242,6 +457,16 @@ void ProcessBankData::run() { // override {
       }
     }
   }
+
+  // Compact the events of the bank as soon as they are in place, so that the
+  // full events of all the banks are never held at once
+  if (alg->compactEvents) {
+    const auto table = m_loader.pulseTable(*thisBankPulseTimes);
+    forEachEventList([&table](EventList &el) {
+      if (!el.empty())
+        el.packCompactColumns(table);
+    });
+  }
   prog->report(entry_name + ": filled events");
 
   alg->getLogger().debug() << entry_name
@@ -263,6 +488,13 @@ void ProcessBankData::run() { // override {
     alg->discarded_events += my_discarded_events;
   }
 
+  // Give the buffers back to the pool as soon as the events are in place, so
+  // that the next banks can be read
+  event_id.reset();
+  event_time_of_flight.reset();
+  event_weight.reset();
+  m_loader.bufferPool.addProcessingTime(timer.elapsed());
+
 #ifndef _WIN32
   alg->getLogger().debug() << "Time to process " << entry_name << " " << m_timer
                            << "\n";
@@ -15,6 +15,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitConversion.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VectorHelper.h"
@@ -23,7 +24,9 @@
 #include <boost/regex.hpp>
 #include <boost/tokenizer.hpp>
 #include <fstream>
+#include <numeric>
 #include <set>
+#include <sstream>
 
 namespace Mantid {
 namespace DataHandling {
@@ -33,6 +36,11 @@ DECLARE_ALGORITHM(SaveAscii2)
 using namespace Kernel;
 using namespace API;
 
+namespace {
+/// Number of spectra formatted in parallel before being written to the file
+constexpr size_t SPECTRA_PER_BLOCK = 256;
+} // namespace
+
 /// Empty constructor
 SaveAscii2::SaveAscii2()
     : m_separatorIndex(), m_nBins(0), m_sep(), m_writeDX(false),
@@ -308,16 +316,30 @@ void SaveAscii2::exec() {
   if (!m_metaData.empty()) {
     populateAllMetaData();
   }
-  if (idx.empty()) {
-    Progress progress(this, 0.0, 1.0, nSpectra);
-    for (int i = 0; i < nSpectra; i++) {
-      writeSpectrum(i, file);
-      progress.report();
+  std::vector<int> indices(idx.begin(), idx.end());
+  if (indices.empty()) {
+    indices.resize(nSpectra);
+    std::iota(indices.begin(), indices.end(), 0);
+  }
+  // Blocks of spectra are formatted in parallel, each into its own stream
+  // with the format of the file, then written to the file in order
+  Progress progress(this, 0.0, 1.0, indices.size());
+  std::vector<std::ostringstream> blocks(SPECTRA_PER_BLOCK);
+  for (size_t first = 0; first < indices.size(); first += SPECTRA_PER_BLOCK) {
+    const auto count = static_cast<int64_t>(
+        std::min(SPECTRA_PER_BLOCK, indices.size() - first));
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < count; ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      auto &block = blocks[i];
+      block.str("");
+      block.copyfmt(file);
+      writeSpectrum(indices[first + i], block);
+      PARALLEL_END_INTERUPT_REGION
     }
-  } else {
-    Progress progress(this, 0.0, 1.0, idx.size());
-    for (int i : idx) {
-      writeSpectrum(i, file);
+    PARALLEL_CHECK_INTERUPT_REGION
+    for (int64_t i = 0; i < count; ++i) {
+      file << blocks[i].rdbuf();
       progress.report();
     }
   }
@@ -326,18 +348,19 @@ void SaveAscii2::exec() {
   file.close();
 }
 
-/** Writes a spectrum to the file using a workspace index
+/** Writes a spectrum to a stream using a workspace index. This does not
+ * change the algorithm, so may be called in parallel for several spectra.
  *
  * @param wsIndex :: an integer relating to a workspace index
- * @param file :: the file writer object
+ * @param file :: the stream to write to
  */
-void SaveAscii2::writeSpectrum(const int &wsIndex, std::ofstream &file) {
+void SaveAscii2::writeSpectrum(const int &wsIndex, std::ostream &file) const {
 
   if (m_writeSpectrumAxisValue) {
     file << m_axisProxy->getCentre(wsIndex) << '\n';
   } else {
     for (auto iter = m_metaData.begin(); iter != m_metaData.end(); ++iter) {
-      auto value = m_metaDataMap[*iter][wsIndex];
+      const auto &value = m_metaDataMap.at(*iter)[wsIndex];
       file << value;
       if (iter != m_metaData.end() - 1) {
         file << " " << m_sep << " ";
@@ -345,21 +368,19 @@ void SaveAscii2::writeSpectrum(const int &wsIndex, std::ofstream &file) {
     }
     file << '\n';
   }
-  auto pointDeltas = m_ws->pointStandardDeviations(0);
-  auto points0 = m_ws->points(0);
-  auto pointsSpec = m_ws->points(wsIndex);
+  // Spectra without their own X errors use those of the first spectrum
+  const auto pointDeltas =
+      m_ws->pointStandardDeviations(m_ws->hasDx(wsIndex) ? wsIndex : 0);
+  const auto points = m_ws->points(m_isCommonBins ? 0 : wsIndex);
+  const auto &y = m_ws->y(wsIndex);
+  const auto &e = m_ws->e(wsIndex);
   for (int bin = 0; bin < m_nBins; bin++) {
-    if (m_isCommonBins) {
-      file << points0[bin];
-    } else // checking for ragged workspace
-    {
-      file << pointsSpec[bin];
-    }
+    file << points[bin];
     file << m_sep;
-    file << m_ws->y(wsIndex)[bin];
+    file << y[bin];
 
     file << m_sep;
-    file << m_ws->e(wsIndex)[bin];
+    file << e[bin];
     if (m_writeDX) {
       file << m_sep;
       file << pointDeltas[bin];
@@ -19,7 +19,9 @@
 #include "MantidGeometry/Crystal/AngleUnits.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidNexus/NexusFileIO.h"
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -161,6 +163,24 @@ void SaveNexusProcessed::init() {
       "CompressNexus",
       std::make_unique<EnabledWhenWorkspaceIsType<EventWorkspace>>(
           "InputWorkspace", true));
+
+  auto compressionLevel = std::make_shared<BoundedValidator<int>>(1, 9);
+  declareProperty(
+      "CompressionLevel", 6, compressionLevel,
+      "For EventWorkspaces saved with CompressNexus, the deflate level of the\n"
+      "events, from 1 (fastest) to 9 (smallest files).");
+  setPropertySettings("CompressionLevel",
+                      std::make_unique<EnabledWhenProperty>(
+                          "CompressNexus", IS_EQUAL_TO, "1"));
+
+  auto mustBeAboveZero = std::make_shared<BoundedValidator<int>>();
+  mustBeAboveZero->setLower(1);
+  declareProperty(
+      "EventChunkSize", 262144, mustBeAboveZero,
+      "For EventWorkspaces saved with CompressNexus, the number of events in\n"
+      "each compressed chunk of the file.");
+  setPropertySettings("EventChunkSize", std::make_unique<EnabledWhenProperty>(
+                                            "CompressNexus", IS_EQUAL_TO, "1"));
 }
 
 /** Get the list of workspace indices to use
@@ -396,9 +416,11 @@ void SaveNexusProcessed::exec() {
 }
 
 //-------------------------------------------------------------------------------------
-/** Append out each field of a vector of events to separate array.
+/** Append out each field of a part of a vector of events to separate arrays.
  *
  * @param events :: vector of TofEvent or WeightedEvent, etc.
+ * @param skip :: number of events before the first one to append
+ * @param count :: number of events to append
  * @param offset :: where the first event goes in the array
  * @param tofs, weights, errorSquareds, pulsetimes :: arrays to write to.
  *        Must be initialized and big enough,
@@ -406,16 +428,17 @@ void SaveNexusProcessed::exec() {
  */
 template <class T>
 void SaveNexusProcessed::appendEventListData(const std::vector<T> &events,
+                                             size_t skip, size_t count,
                                              size_t offset, double *tofs,
                                              float *weights,
                                              float *errorSquareds,
                                              int64_t *pulsetimes) {
   // Do nothing if there are no events.
-  if (events.empty())
+  if (count == 0)
     return;
 
-  const auto it = events.cbegin();
-  const auto it_end = events.cend();
+  const auto it = std::next(events.cbegin(), skip);
+  const auto it_end = std::next(it, count);
 
   // Fill the C-arrays with the fields from all the events, as requested.
   if (tofs) {
@@ -442,13 +465,15 @@ void SaveNexusProcessed::appendEventListData(const std::vector<T> &events,
 
 //-----------------------------------------------------------------------------------------------
 /** Execute the saving of event data.
- * This will make one long event list for all events contained.
+ * This will make one long event list for all events contained. The events
+ * are copied to it and written a block at a time, so that the whole list is
+ * never held in memory.
  * */
 void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
                                    const bool uniformSpectra,
                                    const std::vector<int> &spec) {
   m_progress = std::make_unique<Progress>(
-      this, m_timeProgInit, 1.0, m_eventWorkspace->getNumberEvents() * 2);
+      this, m_timeProgInit, 1.0, m_eventWorkspace->getNumberEvents());
 
   // Start by writing out the axes and crap
   nexusFile->writeNexusProcessedData2D(m_eventWorkspace, uniformSpectra, spec,
@@ -467,13 +492,6 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
   }
   indices.emplace_back(index);
 
-  // Initialize all the arrays
-  int64_t num = index;
-  double *tofs = nullptr;
-  float *weights = nullptr;
-  float *errorSquareds = nullptr;
-  int64_t *pulsetimes = nullptr;
-
   // overall event type.
   EventType type = m_eventWorkspace->getEventType();
   bool writeTOF = true;
@@ -496,60 +514,63 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
     break;
   }
 
-  // --- Initialize the combined event arrays ----
-  if (writeTOF)
-    tofs = new double[num];
-  if (writeWeight)
-    weights = new float[num];
-  if (writeError)
-    errorSquareds = new float[num];
-  if (writePulsetime)
-    pulsetimes = new int64_t[num];
-
-  // --- Fill in the combined event arrays ----
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int wi = 0;
-       wi < static_cast<int>(m_eventWorkspace->getNumberHistograms()); wi++) {
-    PARALLEL_START_INTERUPT_REGION
-    const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(wi);
-
-    // This is where it will land in the output array.
-    // It is okay to write in parallel since none should step on each other.
-    size_t offset = indices[wi];
-
-    switch (el.getEventType()) {
-    case TOF:
-      appendEventListData(el.getEvents(), offset, tofs, weights, errorSquareds,
-                          pulsetimes);
-      break;
-    case WEIGHTED:
-      appendEventListData(el.getWeightedEvents(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    case WEIGHTED_NOTIME:
-      appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    }
-    m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
+  // --- Fill in a block of the combined event arrays ----
+  auto fill = [this, &indices](const int64_t start, const int64_t count,
+                               double *tofs, float *weights,
+                               float *errorSquareds, int64_t *pulsetimes) {
+    const int64_t end = start + count;
+    // The event lists with events in the block
+    const auto first = static_cast<int>(
+        std::upper_bound(indices.cbegin(), indices.cend(), start) -
+        indices.cbegin() - 1);
+    const auto last = static_cast<int>(
+        std::lower_bound(indices.cbegin(), indices.cend(), end) -
+        indices.cbegin());
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int wi = first; wi < last; wi++) {
+      PARALLEL_START_INTERUPT_REGION
+      const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(wi);
+
+      // The part of the list in the block, and where it will land in the
+      // output array.
+      // It is okay to write in parallel since none should step on each other.
+      const int64_t begin = std::max(indices[wi], start);
+      const auto skip = static_cast<size_t>(begin - indices[wi]);
+      const auto num =
+          static_cast<size_t>(std::min(indices[wi + 1], end) - begin);
+      const auto offset = static_cast<size_t>(begin - start);
+
+      switch (el.getEventType()) {
+      case TOF:
+        appendEventListData(el.getEvents(), skip, num, offset, tofs, weights,
+                            errorSquareds, pulsetimes);
+        break;
+      case WEIGHTED:
+        appendEventListData(el.getWeightedEvents(), skip, num, offset, tofs,
+                            weights, errorSquareds, pulsetimes);
+        break;
+      case WEIGHTED_NOTIME:
+        appendEventListData(el.getWeightedEventsNoTime(), skip, num, offset,
+                            tofs, weights, errorSquareds, pulsetimes);
+        break;
+      }
+      m_progress->reportIncrement(num, "Copying EventList");
 
-    PARALLEL_END_INTERUPT_REGION
-  }
-  PARALLEL_CHECK_INTERUPT_REGION
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+  };
 
   /*Default = DONT compress - much faster*/
-  bool CompressNexus = getProperty("CompressNexus");
+  const bool CompressNexus = getProperty("CompressNexus");
+  const int compressionLevel = getProperty("CompressionLevel");
+  const int chunkSize = getProperty("EventChunkSize");
 
   // Write out to the NXS file.
-  nexusFile->writeNexusProcessedDataEventCombined(m_eventWorkspace, indices,
-                                                  tofs, weights, errorSquareds,
-                                                  pulsetimes, CompressNexus);
-
-  // Free mem.
-  delete[] tofs;
-  delete[] weights;
-  delete[] errorSquareds;
-  delete[] pulsetimes;
+  nexusFile->writeNexusProcessedDataEventCombined(
+      m_eventWorkspace, indices, writeTOF, writePulsetime, writeWeight,
+      writeError, CompressNexus ? compressionLevel : 0, chunkSize, fill);
 }
 
 //-----------------------------------------------------------------------------------------------
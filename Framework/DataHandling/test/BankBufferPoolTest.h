@@ -0,0 +1,73 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/BankBufferPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using Mantid::DataHandling::BankBufferPool;
+
+class BankBufferPoolTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BankBufferPoolTest *createSuite() { return new BankBufferPoolTest(); }
+  static void destroySuite(BankBufferPoolTest *suite) { delete suite; }
+
+  void test_acquire_counts_memory_in_use() {
+    BankBufferPool pool(1000);
+    auto ids = pool.acquire<uint32_t>(10);
+    auto tofs = pool.acquire<float>(20);
+    TS_ASSERT_EQUALS(ids->size(), 10);
+    TS_ASSERT_EQUALS(tofs->size(), 20);
+    TS_ASSERT_EQUALS(pool.bytesInUse(), 30 * 4);
+    ids.reset();
+    TS_ASSERT_EQUALS(pool.bytesInUse(), 20 * 4);
+    tofs.reset();
+    TS_ASSERT_EQUALS(pool.bytesInUse(), 0);
+    TS_ASSERT_EQUALS(pool.peakBytesInUse(), 30 * 4);
+  }
+
+  void test_released_buffers_are_reused() {
+    BankBufferPool pool(1000);
+    auto tofs = pool.acquire<float>(100);
+    const auto data = tofs->data();
+    tofs.reset();
+    tofs = pool.acquire<float>(50);
+    TS_ASSERT_EQUALS(tofs->data(), data);
+    TS_ASSERT_EQUALS(tofs->size(), 50);
+  }
+
+  void test_waitForMemory_waits_until_buffers_are_released() {
+    BankBufferPool pool(100);
+    auto ids = pool.acquire<uint32_t>(20);
+    std::atomic<bool> waited{false};
+    std::thread reader([&pool, &waited]() {
+      pool.waitForMemory(40);
+      waited = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    TS_ASSERT(!waited);
+    ids.reset();
+    reader.join();
+    TS_ASSERT(waited);
+    TS_ASSERT(pool.timings().waiting > 0.);
+  }
+
+  void test_waitForMemory_does_not_wait_without_buffers_in_use() {
+    BankBufferPool pool(100);
+    // Larger than the budget, but there is nothing to wait for
+    pool.waitForMemory(1000);
+    auto ids = pool.acquire<uint32_t>(5);
+    pool.waitForMemory(80);
+  }
+};
@@ -362,6 +362,35 @@ public:
     TS_ASSERT_THROWS_NOTHING(Poco::File(m_abspath).remove());
   }
 
+  void test_NaN_values_comments_and_missing_final_newline() {
+    m_testno++;
+    m_abspath = getAbsPath();
+    std::ofstream file(m_abspath.c_str());
+    file << "# X , Y, E\n";
+    file << "1\n";
+    file << "0.5, NaN, 1.#QNAN\n";
+    file << "# a comment between the values\n";
+    file << "  1.5 ,-2e-1, +3 \n";
+    file << "\n";
+    file << "2\n";
+    file << "0.5, 4, 0.25\n";
+    file << "1.5, 5, 0.5";
+    file.close();
+
+    const auto outputWS = runTest(3, false);
+    TS_ASSERT_EQUALS(outputWS->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(outputWS->blocksize(), 2);
+    TS_ASSERT_EQUALS(outputWS->getSpectrum(1).getSpectrumNo(), 2);
+    TS_ASSERT(std::isnan(outputWS->y(0)[0]));
+    TS_ASSERT(std::isnan(outputWS->e(0)[0]));
+    TS_ASSERT_EQUALS(outputWS->x(0)[1], 1.5);
+    TS_ASSERT_EQUALS(outputWS->y(0)[1], -0.2);
+    TS_ASSERT_EQUALS(outputWS->e(0)[1], 3.);
+    TS_ASSERT_EQUALS(outputWS->y(1)[1], 5.);
+    TS_ASSERT_EQUALS(outputWS->e(1)[1], 0.5);
+    TS_ASSERT_THROWS_NOTHING(Poco::File(m_abspath).remove());
+  }
+
   void test_tableworkspace() {
     m_testno++;
     m_abspath = writeTableTestFile("Tab");
@@ -37,7 +37,9 @@ using namespace Mantid::DataHandling;
 using Mantid::Types::Core::DateAndTime;
 using Mantid::Types::Event::TofEvent;
 
-void run_multiprocess_load(const std::string &file, bool precount) {
+void run_multiprocess_load(
+    const std::string &file, bool precount,
+    const std::map<std::string, std::string> &properties = {}) {
   Mantid::API::FrameworkManager::Instance();
   LoadEventNexus ld;
   ld.initialize();
@@ -47,6 +49,8 @@ void run_multiprocess_load(const std::string &file, bool precount) {
   ld.setPropertyValue("OutputWorkspace", outws_name);
   ld.setPropertyValue("Precount", std::to_string(precount));
   ld.setProperty<bool>("LoadLogs", false); // Time-saver
+  for (const auto &property : properties)
+    ld.setPropertyValue(property.first, property.second);
   TS_ASSERT_THROWS_NOTHING(ld.execute());
   TS_ASSERT(ld.isExecuted())
 
@@ -62,6 +66,8 @@ void run_multiprocess_load(const std::string &file, bool precount) {
   ldRef.setPropertyValue("OutputWorkspace", outws_name);
   ldRef.setPropertyValue("Precount", "1");
   ldRef.setProperty<bool>("LoadLogs", false); // Time-saver
+  for (const auto &property : properties)
+    ldRef.setPropertyValue(property.first, property.second);
   TS_ASSERT_THROWS_NOTHING(ldRef.execute());
   TS_ASSERT(ldRef.isExecuted())
 
@@ -241,6 +247,32 @@ public:
     }
   }
 
+  void test_chunks_with_time_filter_load_each_event_of_the_window_once() {
+    auto numberOfEvents = [](const int chunk, const int totalChunks) {
+      LoadEventNexus ld;
+      ld.setChild(true);
+      ld.initialize();
+      ld.setPropertyValue("OutputWorkspace", "dummy_for_child");
+      ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+      ld.setProperty("FilterByTimeStart", 60.);
+      ld.setProperty("FilterByTimeStop", 120.);
+      if (chunk != EMPTY_INT()) {
+        ld.setProperty("ChunkNumber", chunk);
+        ld.setProperty("TotalChunks", totalChunks);
+      }
+      TS_ASSERT_THROWS_NOTHING(ld.execute());
+      Workspace_sptr ws = ld.getProperty("OutputWorkspace");
+      return std::dynamic_pointer_cast<EventWorkspace>(ws)->getNumberEvents();
+    };
+
+    const size_t windowEvents = numberOfEvents(EMPTY_INT(), EMPTY_INT());
+    TS_ASSERT(windowEvents > 0);
+    size_t chunkedEvents = 0;
+    for (int chunk = 1; chunk <= 3; ++chunk)
+      chunkedEvents += numberOfEvents(chunk, 3);
+    TS_ASSERT_EQUALS(chunkedEvents, windowEvents);
+  }
+
   void test_NumberOfBins() {
     const std::string file = "SANS2D00022048.nxs";
     int nBins = 273;
@@ -306,6 +338,27 @@ public:
     }
   }
 
+  void test_multiprocess_loader_filters_by_tof_and_spectrum() {
+    if (!windows) {
+      // Event IDs are detector IDs in this file, unlike in ISIS files
+      const std::map<std::string, std::string> properties{
+          {"FilterByTofMin", "45000"},
+          {"FilterByTofMax", "55000"},
+          {"SpectrumMin", "1000"},
+          {"SpectrumMax", "20000"}};
+      run_multiprocess_load("CNCS_7860_event.nxs", true, properties);
+      run_multiprocess_load("CNCS_7860_event.nxs", false, properties);
+    }
+  }
+
+  void test_multiprocess_loader_filters_by_time() {
+    if (!windows) {
+      const std::map<std::string, std::string> properties{
+          {"FilterByTimeStart", "60"}, {"FilterByTimeStop", "120"}};
+      run_multiprocess_load("LARMOR00003368.nxs", true, properties);
+    }
+  }
+
   void test_SingleBank_PixelsOnlyInThatBank() { doTestSingleBank(true, false); }
 
   void test_load_event_nexus_ornl_eqsans() {
@@ -703,6 +756,122 @@ public:
     }
   }
 
+  void test_Load_And_CompressEvents_while_reading() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_not_compressed");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    LoadEventNexus ldCompressed;
+    ldCompressed.initialize();
+    ldCompressed.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ldCompressed.setPropertyValue("OutputWorkspace", "cncs_linear_compressed");
+    ldCompressed.setPropertyValue("CompressTolerance", "0.05");
+    ldCompressed.setPropertyValue("CompressBinningMode", "Linear");
+    ldCompressed.setProperty<bool>("LoadLogs", false); // Time-saver
+    ldCompressed.execute();
+    TS_ASSERT(ldCompressed.isExecuted());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto full = ads.retrieveWS<EventWorkspace>("cncs_not_compressed");
+    auto compressed = ads.retrieveWS<EventWorkspace>("cncs_linear_compressed");
+    TS_ASSERT_LESS_THAN(compressed->getNumberEvents(), full->getNumberEvents());
+    double totalWeight = 0.;
+    for (size_t wi = 0; wi < compressed->getNumberHistograms(); wi++) {
+      const auto &el = compressed->getSpectrum(wi);
+      if (el.getNumberEvents() == 0)
+        continue;
+      TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED_NOTIME);
+      TS_ASSERT(el.isSortedByTof());
+      const auto &events = el.getWeightedEventsNoTime();
+      // Compressed events are at least one bin width apart
+      for (size_t i = 1; i < events.size(); ++i)
+        TS_ASSERT_LESS_THAN(std::floor(events[i - 1].tof() / 0.05),
+                            std::floor(events[i].tof() / 0.05));
+      for (const auto &event : events)
+        totalWeight += event.weight();
+    }
+    // No event was lost
+    TS_ASSERT_DELTA(totalWeight,
+                    static_cast<double>(full->getNumberEvents()), 1e-6);
+  }
+
+  void test_Load_ColumnarEvents() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_events");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    LoadEventNexus ldColumns;
+    ldColumns.initialize();
+    ldColumns.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ldColumns.setPropertyValue("OutputWorkspace", "cncs_columns");
+    ldColumns.setProperty<bool>("LoadLogs", false); // Time-saver
+    ldColumns.setProperty<bool>("ColumnarEvents", true);
+    ldColumns.execute();
+    TS_ASSERT(ldColumns.isExecuted());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto events = ads.retrieveWS<EventWorkspace>("cncs_events");
+    auto columns = ads.retrieveWS<EventWorkspace>("cncs_columns");
+    TS_ASSERT_EQUALS(columns->getNumberEvents(), events->getNumberEvents());
+    for (size_t wi = 0; wi < events->getNumberHistograms(); wi += 1000) {
+      TS_ASSERT(columns->getSpectrum(wi).hasColumns());
+      TS_ASSERT_EQUALS(columns->getSpectrum(wi).getEvents(),
+                       events->getSpectrum(wi).getEvents());
+    }
+    ads.remove("cncs_events");
+    ads.remove("cncs_columns");
+  }
+
+  void test_Load_CompactEvents() {
+    Mantid::API::FrameworkManager::Instance();
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_full");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    LoadEventNexus ldCompact;
+    ldCompact.initialize();
+    ldCompact.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ldCompact.setPropertyValue("OutputWorkspace", "cncs_compact");
+    ldCompact.setProperty<bool>("LoadLogs", false); // Time-saver
+    ldCompact.setProperty<bool>("CompactEvents", true);
+    ldCompact.execute();
+    TS_ASSERT(ldCompact.isExecuted());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto full = ads.retrieveWS<EventWorkspace>("cncs_full");
+    auto compact = ads.retrieveWS<EventWorkspace>("cncs_compact");
+    TS_ASSERT_EQUALS(compact->getNumberEvents(), full->getNumberEvents());
+    TS_ASSERT_LESS_THAN(compact->getMemorySize(), full->getMemorySize());
+    for (size_t wi = 0; wi < full->getNumberHistograms(); wi += 1000) {
+      TS_ASSERT_EQUALS(compact->getSpectrum(wi).hasColumns(),
+                       !compact->getSpectrum(wi).empty());
+      const auto &fullEvents = full->getSpectrum(wi).getEvents();
+      const auto &compactEvents = compact->getSpectrum(wi).getEvents();
+      TS_ASSERT_EQUALS(fullEvents.size(), compactEvents.size());
+      for (size_t i = 0; i < fullEvents.size(); ++i) {
+        TS_ASSERT_EQUALS(compactEvents[i].pulseTime(),
+                         fullEvents[i].pulseTime());
+        TS_ASSERT_DELTA(compactEvents[i].tof(), fullEvents[i].tof(), 1e-3);
+      }
+    }
+    ads.remove("cncs_full");
+    ads.remove("cncs_compact");
+  }
+
   void test_Monitors() {
     // Uses the workspace loaded in the last test to save a load execution
     std::string mon_outws_name = "cncs_compressed_monitors";
@@ -373,6 +373,36 @@ public:
                     4.8888, 0.0001);
   }
 
+  void testExecNIMRODTwiceReusesInstrumentUntilRemovedFromIDS() {
+    InstrumentDataServiceImpl &IDS = InstrumentDataService::Instance();
+    IDS.clear();
+
+    auto loadNIMROD = []() {
+      LoadInstrument loader;
+      loader.initialize();
+      loader.setChild(true);
+      MatrixWorkspace_sptr ws2D =
+          DataObjects::create<Workspace2D>(1, HistogramData::Points(1));
+      loader.setPropertyValue("Filename", "NIM_Definition.xml");
+      loader.setProperty("RewriteSpectraMap", OptionalBool(true));
+      loader.setProperty("Workspace", ws2D);
+      loader.execute();
+      TS_ASSERT(loader.isExecuted());
+      return ws2D->getInstrument()->baseInstrument();
+    };
+
+    const auto first = loadNIMROD();
+    TS_ASSERT_EQUALS(loadNIMROD(), first);
+    TS_ASSERT_EQUALS(IDS.size(), 1);
+
+    // The definition is parsed again once the instrument is removed
+    IDS.clear();
+    const auto reparsed = loadNIMROD();
+    TS_ASSERT_DIFFERS(reparsed, first);
+    TS_ASSERT_EQUALS(reparsed->getNumberDetectors(), 1521);
+    TS_ASSERT_EQUALS(IDS.size(), 1);
+  }
+
   void testExecMARIFromInstrName() {
     LoadInstrument loaderMARI;
     loaderMARI.initialize();
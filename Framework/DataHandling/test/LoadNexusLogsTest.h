@@ -76,6 +76,26 @@ public:
     // Now the stats
   }
 
+  void test_File_With_DASLogs_In_Allow_And_Block_Lists() {
+    LoadNexusLogs ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "REF_L_32035.nxs");
+    MatrixWorkspace_sptr ws = createTestWorkspace();
+    ld.setProperty("Workspace", ws);
+    ld.setPropertyValue("LogAllowList", "Phase*,Speed3");
+    ld.setPropertyValue("LogBlockList", "Phase1");
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    const Run &run = ws->run();
+    TS_ASSERT(run.getLogData().size() < 75);
+    TS_ASSERT(run.hasProperty("Speed3"));
+    TS_ASSERT(run.hasProperty("PhaseRequest1"));
+    TS_ASSERT(!run.hasProperty("Phase1"));
+    // Always loaded, as event loading relies on it
+    TS_ASSERT(run.hasProperty("proton_charge"));
+  }
+
   void test_File_With_Runlog_And_Selog() {
     LoadNexusLogs loader;
     loader.initialize();
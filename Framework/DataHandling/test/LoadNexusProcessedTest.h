@@ -448,6 +448,77 @@ public:
     doCommonEventLoadChecks(alg, 5, 2);
   }
 
+  void test_loadEventNexus_List_reads_only_listed_spectra() {
+    writeTmpEventNexus();
+
+    LoadNexusProcessed alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    alg.setPropertyValue("Filename", m_savedTmpEventFile);
+    alg.setPropertyValue("OutputWorkspace", output_ws);
+    // Out of order, with a run of consecutive spectra
+    alg.setPropertyValue("SpectrumList", "6,4,5");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+
+    auto ws = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+        output_ws);
+    TS_ASSERT(ws);
+    if (!ws)
+      return;
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), 3);
+    TS_ASSERT_EQUALS(ws->getSpectrum(0).getNumberEvents(), 60);
+    TS_ASSERT_EQUALS(ws->getSpectrum(1).getNumberEvents(), 30);
+    TS_ASSERT_EQUALS(ws->getSpectrum(2).getNumberEvents(), 0);
+    TS_ASSERT_DELTA(ws->getSpectrum(1).getEvent(29).tof(), 29.5, 1e-9);
+  }
+
+  void test_load_histograms_of_spectrum_list_and_allowed_logs() {
+    MatrixWorkspace_sptr inputWs =
+        WorkspaceFactory::Instance().create("Workspace2D", 5, 4, 3);
+    for (size_t i = 0; i < inputWs->getNumberHistograms(); ++i) {
+      inputWs->mutableX(i) = {1., 2., 3., 4.};
+      inputWs->mutableY(i) = static_cast<double>(i);
+    }
+    inputWs->mutableRun().addProperty("kept_log", 1.0);
+    inputWs->mutableRun().addProperty("skipped_log", 2.0);
+    inputWs->mutableRun().addProperty("kept_blocked_log", 3.0);
+    inputWs->mutableRun().setProtonCharge(4.0);
+    const std::string filename = "LoadNexusProcessed_AllowedLogs.nxs";
+    IAlgorithm_sptr save =
+        AlgorithmManager::Instance().create("SaveNexusProcessed");
+    save->initialize();
+    save->setProperty("InputWorkspace", inputWs);
+    save->setPropertyValue("Filename", filename);
+    TS_ASSERT_THROWS_NOTHING(save->execute());
+
+    LoadNexusProcessed alg;
+    alg.initialize();
+    alg.setPropertyValue("Filename", save->getPropertyValue("Filename"));
+    alg.setPropertyValue("OutputWorkspace", output_ws);
+    alg.setPropertyValue("SpectrumList", "5,1,2");
+    alg.setPropertyValue("LogAllowList", "kept_*");
+    alg.setPropertyValue("LogBlockList", "*_blocked_log");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+        output_ws);
+    TS_ASSERT(ws);
+    if (ws) {
+      TS_ASSERT_EQUALS(ws->getNumberHistograms(), 3);
+      TS_ASSERT_EQUALS(ws->y(0)[0], 4.);
+      TS_ASSERT_EQUALS(ws->y(1)[0], 0.);
+      TS_ASSERT_EQUALS(ws->y(2)[2], 1.);
+      TS_ASSERT(ws->run().hasProperty("kept_log"));
+      TS_ASSERT(!ws->run().hasProperty("skipped_log"));
+      TS_ASSERT(!ws->run().hasProperty("kept_blocked_log"));
+      // Always loaded, for normalisation by current
+      TS_ASSERT_DELTA(ws->run().getProtonCharge(), 4.0, 1e-12);
+    }
+
+    const std::string savedFile = save->getPropertyValue("Filename");
+    if (Poco::File(savedFile).exists())
+      Poco::File(savedFile).remove();
+  }
+
   void test_load_saved_workspace_group() {
     LoadNexusProcessed alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize());
@@ -11,6 +11,7 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataHandling/Load.h"
+#include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/ConfigService.h"
 #include <cxxtest/TestSuite.h>
@@ -164,6 +165,107 @@ public:
     TS_ASSERT_EQUALS(2, foundFiles[0].size());
   }
 
+  void test_Plus_Operator_Sums_Files_And_Removes_Temporary_Workspaces() {
+    Load single;
+    single.initialize();
+    single.setPropertyValue("Filename", "IRS38633.nxs");
+    single.setPropertyValue("OutputWorkspace", "LoadTest_single");
+    TS_ASSERT_THROWS_NOTHING(single.execute());
+
+    Load loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", "IRS38633+38633+38633.nxs");
+    loader.setPropertyValue("OutputWorkspace", "LoadTest_sum");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto one = ads.retrieveWS<MatrixWorkspace>("LoadTest_single");
+    auto sum = ads.retrieveWS<MatrixWorkspace>("LoadTest_sum");
+    TS_ASSERT(one && sum);
+    if (one && sum) {
+      TS_ASSERT_EQUALS(sum->getNumberHistograms(), one->getNumberHistograms());
+      for (size_t i = 0; i < one->y(0).size(); ++i)
+        TS_ASSERT_DELTA(sum->y(0)[i], 3. * one->y(0)[i], 1e-9);
+    }
+    TS_ASSERT(!ads.doesExist("__@loadsum_temp@0"));
+    TS_ASSERT(!ads.doesExist("__@loadsum_temp@1"));
+
+    ads.remove("LoadTest_single");
+    ads.remove("LoadTest_sum");
+  }
+
+  void test_Plus_Operator_Sums_Event_Files() {
+    Load single;
+    single.initialize();
+    single.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    single.setPropertyValue("OutputWorkspace", "LoadTest_single");
+    TS_ASSERT_THROWS_NOTHING(single.execute());
+
+    Load loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename",
+                            "CNCS_7860_event.nxs+CNCS_7860_event.nxs");
+    loader.setPropertyValue("OutputWorkspace", "LoadTest_sum");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto one = ads.retrieveWS<EventWorkspace>("LoadTest_single");
+    auto sum = ads.retrieveWS<EventWorkspace>("LoadTest_sum");
+    TS_ASSERT(one && sum);
+    if (one && sum) {
+      TS_ASSERT_EQUALS(sum->getNumberHistograms(), one->getNumberHistograms());
+      TS_ASSERT_EQUALS(sum->getNumberEvents(), 2 * one->getNumberEvents());
+      TS_ASSERT_EQUALS(sum->getSpectrum(0).getNumberEvents(),
+                       2 * one->getSpectrum(0).getNumberEvents());
+    }
+    TS_ASSERT(!ads.doesExist("__@loadsum_temp@0"));
+
+    ads.remove("LoadTest_single");
+    ads.remove("LoadTest_sum");
+  }
+
+  void test_Plus_Operator_Sums_Multi_Period_Files() {
+    Load single;
+    single.initialize();
+    single.setPropertyValue("Filename", "POLREF00004699.nxs");
+    single.setPropertyValue("OutputWorkspace", "LoadTest_single");
+    TS_ASSERT_THROWS_NOTHING(single.execute());
+
+    Load loader;
+    loader.initialize();
+    loader.setPropertyValue(
+        "Filename",
+        "POLREF00004699.nxs+POLREF00004699.nxs+POLREF00004699.nxs");
+    loader.setPropertyValue("OutputWorkspace", "LoadTest_sum");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto one = ads.retrieveWS<WorkspaceGroup>("LoadTest_single");
+    auto sum = ads.retrieveWS<WorkspaceGroup>("LoadTest_sum");
+    TS_ASSERT(one && sum);
+    if (one && sum) {
+      TS_ASSERT_EQUALS(sum->size(), one->size());
+      for (size_t period = 0; period < one->size(); ++period) {
+        auto onePeriod =
+            std::dynamic_pointer_cast<MatrixWorkspace>(one->getItem(period));
+        auto sumPeriod =
+            std::dynamic_pointer_cast<MatrixWorkspace>(sum->getItem(period));
+        TS_ASSERT(onePeriod && sumPeriod);
+        if (onePeriod && sumPeriod)
+          TS_ASSERT_DELTA(sumPeriod->y(0)[0], 3. * onePeriod->y(0)[0], 1e-9);
+      }
+    }
+    // Neither the files summed nor their periods are left behind
+    for (const auto &name :
+         ads.getObjectNames(DataServiceSort::Unsorted,
+                            DataServiceHidden::Include)) {
+      TSM_ASSERT(name,
+                 !boost::algorithm::starts_with(name, "__@loadsum_temp@"));
+    }
+
+    ads.clear();
+  }
+
   void test_Range_Operator_Finds_Correct_Number_Of_Files() {
     Load loader;
     loader.initialize();
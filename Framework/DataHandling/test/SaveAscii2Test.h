@@ -195,6 +195,46 @@ public:
     AnalysisDataService::Instance().remove(m_name);
   }
 
+  void testExec_DX_of_each_spectrum() {
+    Mantid::DataObjects::Workspace2D_sptr wsToSave =
+        std::dynamic_pointer_cast<Mantid::DataObjects::Workspace2D>(
+            WorkspaceFactory::Instance().create("Workspace2D", 3, 3, 3));
+    for (size_t i = 0; i < wsToSave->getNumberHistograms(); i++) {
+      wsToSave->mutableX(i) = {0., 1., 2.};
+      wsToSave->mutableY(i) = 1.;
+      wsToSave->mutableE(i) = 1.;
+      wsToSave->setPointStandardDeviations(i, 3);
+      wsToSave->mutableDx(i) = static_cast<double>(i + 1);
+    }
+    AnalysisDataService::Instance().add(m_name, wsToSave);
+
+    SaveAscii2 save;
+    std::string filename = initSaveAscii2(save);
+    TS_ASSERT_THROWS_NOTHING(save.setPropertyValue("WriteXError", "1"));
+    TS_ASSERT_THROWS_NOTHING(save.execute());
+
+    // The DX column of the data lines of each spectrum, in file order
+    std::ifstream in(filename.c_str());
+    std::string line;
+    std::vector<std::string> columns;
+    std::vector<double> dx;
+    while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#')
+        continue;
+      boost::split(columns, line, boost::is_any_of(","));
+      if (columns.size() == 4)
+        dx.emplace_back(boost::lexical_cast<double>(columns[3]));
+    }
+    in.close();
+
+    TS_ASSERT_EQUALS(dx.size(), 9);
+    for (size_t i = 0; i < dx.size(); ++i)
+      TS_ASSERT_EQUALS(dx[i], static_cast<double>(i / 3 + 1));
+
+    Poco::File(filename).remove();
+    AnalysisDataService::Instance().remove(m_name);
+  }
+
   void test_valid_SpectrumMetaData_values() {
     MatrixWorkspace_sptr wsToSave;
     writeInelasticWS(wsToSave);
@@ -325,6 +325,96 @@ public:
         true /* DONT preserve events */, true /* Compress */);
   }
 
+  void testExec_EventWorkspace_CompressNexus_in_small_chunks() {
+    std::vector<std::vector<int>> groups{{10, 11, 12}, {20}, {30, 31}};
+    EventWorkspace_sptr ws =
+        WorkspaceCreationHelper::createGroupedEventWorkspace(groups, 100, 1.0,
+                                                             1.0);
+    for (size_t wi = 0; wi < ws->getNumberHistograms(); ++wi)
+      ws->getSpectrum(wi).switchTo(WEIGHTED);
+    ws->getSpectrum(1) *= 2.;
+
+    // Blocks of chunks of 7 events straddle the event lists
+    SaveNexusProcessed alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace", std::dynamic_pointer_cast<Workspace>(ws));
+    alg.setPropertyValue("Filename", "SaveNexusProcessed_SmallChunks.nxs");
+    alg.setProperty("CompressNexus", true);
+    alg.setProperty("CompressionLevel", 1);
+    alg.setProperty("EventChunkSize", 7);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    const std::string outputFile = alg.getPropertyValue("Filename");
+
+    LoadNexus loadAlg;
+    loadAlg.initialize();
+    loadAlg.setPropertyValue("Filename", outputFile);
+    loadAlg.setPropertyValue("OutputWorkspace", "SmallChunksReloaded");
+    TS_ASSERT_THROWS_NOTHING(loadAlg.execute());
+    auto reloaded = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+        "SmallChunksReloaded");
+    TS_ASSERT(reloaded);
+    if (reloaded) {
+      TS_ASSERT_EQUALS(reloaded->getNumberEvents(), ws->getNumberEvents());
+      for (size_t wi = 0; wi < ws->getNumberHistograms(); ++wi) {
+        const auto &expected = ws->getSpectrum(wi).getWeightedEvents();
+        const auto &actual = reloaded->getSpectrum(wi).getWeightedEvents();
+        TS_ASSERT_EQUALS(actual.size(), expected.size());
+        for (size_t i = 0; i < std::min(actual.size(), expected.size()); ++i) {
+          TS_ASSERT_EQUALS(actual[i].tof(), expected[i].tof());
+          TS_ASSERT_EQUALS(actual[i].weight(), expected[i].weight());
+        }
+      }
+    }
+
+    AnalysisDataService::Instance().remove("SmallChunksReloaded");
+    if (clearfiles)
+      Poco::File(outputFile).remove();
+  }
+
+  void testExec_ragged_histograms_of_index_range() {
+    const size_t nHist = 6;
+    const size_t nBins = 4;
+    Workspace2D_sptr ws =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(nHist, nBins);
+    for (size_t i = 0; i < nHist; ++i) {
+      auto &x = ws->mutableX(i);
+      for (size_t j = 0; j < x.size(); ++j)
+        x[j] = static_cast<double>(i + j);
+      ws->mutableY(i)[0] = static_cast<double>(i);
+    }
+
+    SaveNexusProcessed alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace", std::dynamic_pointer_cast<Workspace>(ws));
+    alg.setPropertyValue("Filename", "SaveNexusProcessed_RaggedRange.nxs");
+    alg.setProperty("WorkspaceIndexMin", 2);
+    alg.setProperty("WorkspaceIndexMax", 4);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    const std::string outputFile = alg.getPropertyValue("Filename");
+
+    LoadNexus loadAlg;
+    loadAlg.initialize();
+    loadAlg.setPropertyValue("Filename", outputFile);
+    loadAlg.setPropertyValue("OutputWorkspace", "RaggedRangeReloaded");
+    TS_ASSERT_THROWS_NOTHING(loadAlg.execute());
+    auto reloaded = AnalysisDataService::Instance().retrieveWS<Workspace2D>(
+        "RaggedRangeReloaded");
+    TS_ASSERT(reloaded);
+    if (reloaded) {
+      TS_ASSERT_EQUALS(reloaded->getNumberHistograms(), 3);
+      for (size_t i = 0; i < reloaded->getNumberHistograms(); ++i) {
+        TS_ASSERT_EQUALS(reloaded->x(i)[0], static_cast<double>(i + 2));
+        TS_ASSERT_EQUALS(reloaded->y(i)[0], static_cast<double>(i + 2));
+      }
+    }
+
+    AnalysisDataService::Instance().remove("RaggedRangeReloaded");
+    if (clearfiles)
+      Poco::File(outputFile).remove();
+  }
+
   void testExecSaveLabel() {
     SaveNexusProcessed alg;
     if (!alg.isInitialized())
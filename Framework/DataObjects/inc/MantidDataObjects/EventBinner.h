@@ -0,0 +1,90 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidKernel/cow_ptr.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** @class Mantid::DataObjects::EventBinner
+
+  Finds the bin of events in constant time when the bin edges are linearly or
+  logarithmically spaced, as produced by the usual Rebin parameters. The events
+  do not need to be sorted.
+
+  The bin is first computed in closed form for a block of values, in a loop
+  simple enough for the compiler to vectorise, then checked against the actual
+  bin edges so that the result is exactly that of a search in the edges: bins
+  are half open, [X[i], X[i+1]).
+*/
+class MANTID_DATAOBJECTS_DLL EventBinner {
+public:
+  /// How the bin edges are spaced
+  enum class Spacing { Linear, Logarithmic, Arbitrary };
+
+  explicit EventBinner(const MantidVec &X);
+
+  /// How the bin edges are spaced
+  Spacing spacing() const { return m_spacing; }
+  /// True if the bins can be found in closed form
+  bool isClosedForm() const { return m_spacing != Spacing::Arbitrary; }
+
+  void findBins(const double *values, const std::size_t count,
+                int64_t *bins) const;
+
+  /** Call add(bin, event) for every event inside the histogram. Only valid if
+   * isClosedForm().
+   * @param events :: the events to bin, in any order
+   * @param value :: functor returning the value to bin an event by
+   * @param add :: functor accumulating an event in a bin
+   */
+  template <typename T, typename VALUE, typename ADD>
+  void binEvents(const std::vector<T> &events, VALUE value, ADD add) const {
+    binEvents(events, 0, events.size(), value, add);
+  }
+
+  /** Call add(bin, event) for the events of indices [begin, end) inside the
+   * histogram. Only valid if isClosedForm().
+   */
+  template <typename T, typename VALUE, typename ADD>
+  void binEvents(const std::vector<T> &events, const std::size_t begin,
+                 const std::size_t end, VALUE value, ADD add) const {
+    constexpr std::size_t blockSize = 1024;
+    std::array<double, blockSize> values;
+    std::array<int64_t, blockSize> bins;
+    for (std::size_t start = begin; start < end; start += blockSize) {
+      const auto count = std::min(blockSize, end - start);
+      for (std::size_t i = 0; i < count; ++i)
+        values[i] = value(events[start + i]);
+      findBins(values.data(), count, bins.data());
+      for (std::size_t i = 0; i < count; ++i) {
+        if (bins[i] >= 0)
+          add(static_cast<std::size_t>(bins[i]), events[start + i]);
+      }
+    }
+  }
+
+private:
+  /// Bin edges
+  const MantidVec &m_X;
+  /// How the bin edges are spaced
+  Spacing m_spacing;
+  /// Number of bins
+  int64_t m_numBins;
+  /// Inverse of the (logarithmic) step
+  double m_inverseStep;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -0,0 +1,137 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/Events.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** @class Mantid::DataObjects::EventColumns
+
+  Structure-of-arrays storage for the events of an EventList. The time of
+  flight, pulse time, weight and squared error of each event live in separate
+  contiguous columns, so that operations touching only one of them (e.g.
+  histogramming or unit conversion, which only need the TOF) do not have to
+  pull the other fields through the cache.
+
+  The columns that are present depend on the event type that was packed:
+    - TOF:             tof, pulse time
+    - WEIGHTED:        tof, pulse time, weight, error squared
+    - WEIGHTED_NOTIME: tof, weight, error squared
+
+  The columns can also be held in a compact encoding (see compact()), where
+  the tof is stored in single precision and the pulse time is replaced by a
+  32 bit index into a pulse table shared between many event lists. This halves
+  the memory used by TofEvent's, whose pulse times repeat for every event of a
+  pulse.
+*/
+class MANTID_DATAOBJECTS_DLL EventColumns {
+public:
+  /// Sorted, unique pulse times in nanoseconds indexed by compact events
+  using PulseTable = std::vector<int64_t>;
+
+  EventColumns();
+  explicit EventColumns(const std::vector<Types::Event::TofEvent> &events);
+  explicit EventColumns(const std::vector<WeightedEvent> &events);
+  explicit EventColumns(const std::vector<WeightedEventNoTime> &events);
+
+  /// The type of event that the columns represent
+  API::EventType getEventType() const { return m_eventType; }
+  /// Number of events held
+  std::size_t size() const {
+    return m_compact ? m_compactTof.size() : m_tof.size();
+  }
+  /// True if there are no events held
+  bool empty() const { return size() == 0; }
+  std::size_t getMemorySize() const;
+
+  void compact(std::shared_ptr<const PulseTable> pulseTable = nullptr);
+  /// True if the columns use the compact encoding
+  bool isCompact() const { return m_compact; }
+
+  void unpack(std::vector<Types::Event::TofEvent> &events) const;
+  void unpack(std::vector<WeightedEvent> &events) const;
+  void unpack(std::vector<WeightedEventNoTime> &events) const;
+
+  void sortTof();
+  void sortPulseTime();
+  void reverse();
+
+  void generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E,
+                         bool skipError = false) const;
+
+  void convertTof(const double factor, const double offset);
+  void convertTof(const std::function<double(double)> &func);
+
+  void filterByPulseTime(const Types::Core::DateAndTime &start,
+                         const Types::Core::DateAndTime &stop,
+                         EventColumns &output) const;
+
+  void getTofs(std::vector<double> &tofs) const;
+
+  /// Time-of-flight column. Empty when compact
+  const std::vector<double> &tofs() const { return m_tof; }
+  /// Pulse time column, in nanoseconds. Empty for WEIGHTED_NOTIME or when
+  /// compact
+  const std::vector<int64_t> &pulseTimes() const { return m_pulseTime; }
+  /// Single precision time-of-flight column. Empty unless compact
+  const std::vector<float> &compactTofs() const { return m_compactTof; }
+  /// Index of the pulse time of each event in the pulse table. Empty unless
+  /// compact
+  const std::vector<uint32_t> &pulseIndices() const { return m_pulseIndex; }
+  /// The pulse table shared by compact columns
+  const std::shared_ptr<const PulseTable> &pulseTable() const {
+    return m_pulseTable;
+  }
+  /// Weight column. Empty for TOF
+  const std::vector<float> &weights() const { return m_weight; }
+  /// Squared error column. Empty for TOF
+  const std::vector<float> &errorSquareds() const { return m_errorSquared; }
+
+private:
+  template <typename KEY> void sortByColumn(const std::vector<KEY> &key);
+  bool indexPulseTimes(const std::shared_ptr<const PulseTable> &pulseTable,
+                       std::vector<uint32_t> &pulseIndex) const;
+  /// Time-of-flight of the i-th event, whatever the encoding
+  double tofAt(const size_t i) const {
+    return m_compact ? static_cast<double>(m_compactTof[i]) : m_tof[i];
+  }
+  /// Pulse time of the i-th event in nanoseconds, whatever the encoding
+  int64_t pulseTimeAt(const size_t i) const {
+    return m_compact ? (*m_pulseTable)[m_pulseIndex[i]] : m_pulseTime[i];
+  }
+
+  /// The type of event that was packed
+  API::EventType m_eventType;
+  /// Time-of-flight (or other x value) of each event
+  std::vector<double> m_tof;
+  /// Pulse time of each event in nanoseconds
+  std::vector<int64_t> m_pulseTime;
+  /// Weight of each event
+  std::vector<float> m_weight;
+  /// Squared error of each event
+  std::vector<float> m_errorSquared;
+  /// True if the compact encoding is used
+  bool m_compact;
+  /// Single precision time-of-flight of each event (compact encoding)
+  std::vector<float> m_compactTof;
+  /// Index of the pulse time of each event in m_pulseTable (compact encoding)
+  std::vector<uint32_t> m_pulseIndex;
+  /// Pulse times referenced by m_pulseIndex (compact encoding)
+  std::shared_ptr<const PulseTable> m_pulseTable;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -7,11 +7,14 @@
 #pragma once
 
 #include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/EventSelection.h"
 #include "MantidDataObjects/Events.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/cow_ptr.h"
+#include <cstdint>
 #include <iosfwd>
+#include <memory>
 #include <vector>
 
 namespace Mantid {
@@ -26,6 +29,7 @@ using TimeSplitterType = std::vector<SplittingInterval>;
 class Unit;
 } // namespace Kernel
 namespace DataObjects {
+class EventColumns;
 class EventWorkspaceMRU;
 
 /// How the event list is sorted.
@@ -98,14 +102,17 @@ public:
 
   // --------------------------------------------------------------------------
   /** Append an event to the histogram, without clearing the cache, to make it
-   *faster.
+   *faster. Histograms cached for the list are not used afterwards, as its
+   *version changes.
    * NOTE: Only call this on a un-weighted event list!
    *
    * @param event :: TofEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const Types::Event::TofEvent &event) {
+    unpackColumns();
     this->events.emplace_back(event);
     this->order = UNSORTED;
+    ++m_version;
   }
 
   // --------------------------------------------------------------------------
@@ -114,8 +121,10 @@ public:
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
+    unpackColumns();
     this->weightedEvents.emplace_back(event);
     this->order = UNSORTED;
+    ++m_version;
   }
 
   // --------------------------------------------------------------------------
@@ -124,8 +133,10 @@ public:
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
+    unpackColumns();
     this->weightedEventsNoTime.emplace_back(event);
     this->order = UNSORTED;
+    ++m_version;
   }
 
   Mantid::API::EventType getEventType() const override;
@@ -207,8 +218,28 @@ public:
 
   size_t getMemorySize() const override;
 
+  void packColumns();
+  void packCompactColumns(
+      std::shared_ptr<const std::vector<int64_t>> pulseTable = nullptr);
+  /// Move the events back to the event vectors if they are held in columns
+  /// or selected from another list. Does nothing, and takes no lock, if they
+  /// already are in the vectors.
+  void unpackColumns() const {
+    if (m_columns || m_selection)
+      unpackStorage();
+  }
+  /// True if the events are currently held in columnar storage
+  bool hasColumns() const { return static_cast<bool>(m_columns); }
+
+  void selectFrom(std::shared_ptr<const EventList> parent,
+                  std::vector<EventSelection::Range> ranges);
+  /// True if the events are currently a selection of another list's events
+  bool hasSelection() const { return static_cast<bool>(m_selection); }
+
   virtual size_t histogram_size() const;
 
+  /// Lists with at least this many events are compressed in parallel
+  static constexpr size_t PARALLEL_COMPRESS_SIZE = 1000000;
   void compressEvents(double tolerance, EventList *destination);
   void compressFatEvents(const double tolerance,
                          const Types::Core::DateAndTime &timeStart,
@@ -296,6 +327,12 @@ public:
                        std::map<int, EventList *> outputs, bool docorrection,
                        double toffactor, double tofshift) const;
 
+  /// Split events by full time into outputs indexed by target group + 1
+  void splitByFullTime(Kernel::TimeSplitterType &splitter,
+                       const std::vector<EventList *> &outputs,
+                       bool docorrection, double toffactor, double tofshift,
+                       const bool lazy = false) const;
+
   /// Split ...
   std::string
   splitByFullTimeMatrixSplitter(const std::vector<int64_t> &vec_splitters_time,
@@ -304,10 +341,23 @@ public:
                                 bool docorrection, double toffactor,
                                 double tofshift) const;
 
+  /// Split events by full time into outputs indexed by target group + 1
+  std::string
+  splitByFullTimeMatrixSplitter(const std::vector<int64_t> &vec_splitters_time,
+                                const std::vector<int> &vecgroups,
+                                const std::vector<EventList *> &outputs,
+                                bool docorrection, double toffactor,
+                                double tofshift, const bool lazy = false) const;
+
   /// Split events by pulse time
   void splitByPulseTime(Kernel::TimeSplitterType &splitter,
                         std::map<int, EventList *> outputs) const;
 
+  /// Split events by pulse time into outputs indexed by target group + 1
+  void splitByPulseTime(Kernel::TimeSplitterType &splitter,
+                        const std::vector<EventList *> &outputs,
+                        const bool lazy = false) const;
+
   /// Split events by pulse time with Matrix splitters
   void splitByPulseTimeWithMatrix(const std::vector<int64_t> &vec_times,
                                   const std::vector<int> &vec_target,
@@ -377,15 +427,26 @@ private:
   /// List of WeightedEvent's
   mutable std::vector<WeightedEventNoTime> weightedEventsNoTime;
 
+  /// Columnar copy of the events. When set, the vectors above are empty.
+  mutable std::unique_ptr<EventColumns> m_columns;
+
+  /// Events of another list that are read in place and copied when this
+  /// list is modified. When set, the vectors above are empty.
+  mutable std::shared_ptr<const EventSelection> m_selection;
+
   /// What type of event is in our list.
   Mantid::API::EventType eventType;
 
   /// Last sorting order
   mutable EventSortType order;
 
-  /// MRU lists of the parent EventWorkspace
+  /// Histogram cache of the parent EventWorkspace
   mutable EventWorkspaceMRU *mru;
 
+  /// Changed whenever the events change, so that histograms cached for a
+  /// previous version are not used
+  uint64_t m_version{0};
+
   /// Mutex that is locked while sorting an event list
   mutable std::mutex m_sortMutex;
 
@@ -424,10 +485,15 @@ private:
   static void compressEventsHelper(const std::vector<T> &events,
                                    std::vector<WeightedEventNoTime> &out,
                                    double tolerance);
+  template <class IT>
+  static void compressEventRangeHelper(IT first, IT last,
+                                       std::vector<WeightedEventNoTime> &out,
+                                       double tolerance);
   template <class T>
-  void compressEventsParallelHelper(const std::vector<T> &events,
-                                    std::vector<WeightedEventNoTime> &out,
-                                    double tolerance);
+  static void
+  compressEventsParallelHelper(const std::vector<T> &events,
+                               std::vector<WeightedEventNoTime> &out,
+                               double tolerance);
   template <class T>
   static void compressFatEventsHelper(
       const std::vector<T> &events, std::vector<WeightedEvent> &out,
@@ -498,16 +564,19 @@ private:
   void splitByTimeHelper(Kernel::TimeSplitterType &splitter,
                          std::vector<EventList *> outputs,
                          typename std::vector<T> &events) const;
-  template <class T>
-  void splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
-                             std::map<int, EventList *> outputs,
-                             typename std::vector<T> &events, bool docorrection,
-                             double toffactor, double tofshift) const;
-  /// Split events by pulse time
-  template <class T>
-  void splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
-                              std::map<int, EventList *> outputs,
-                              typename std::vector<T> &events) const;
+  void initializeSplitOutputs(const std::vector<EventList *> &outputs) const;
+  template <class TIME>
+  void splitByIntervals(Kernel::TimeSplitterType &splitter,
+                        const std::vector<EventList *> &outputs,
+                        TIME eventTime, const bool lazy) const;
+  std::string distributeToOutputs(const std::vector<uint32_t> &slots,
+                                  const std::vector<EventList *> &outputs,
+                                  const bool lazy) const;
+  std::shared_ptr<const EventList> shareEvents() const;
+  void unpackStorage() const;
+  void copySelectedEvents() const;
+  void appendSelectedEvents(const EventSelection &selection) const;
+  const EventList &eventsToRead(std::unique_ptr<EventList> &copy) const;
 
   /// Split events (template) by pulse time with matrix splitters
   template <class T>
@@ -517,18 +586,6 @@ private:
                                    std::map<int, EventList *> outputs,
                                    typename std::vector<T> &events) const;
 
-  template <class T>
-  std::string splitByFullTimeVectorSplitterHelper(
-      const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-      std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-      bool docorrection, double toffactor, double tofshift) const;
-
-  template <class T>
-  std::string splitByFullTimeSparseVectorSplitterHelper(
-      const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-      std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-      bool docorrection, double toffactor, double tofshift) const;
-
   template <class T>
   static void multiplyHelper(std::vector<T> &events, const double value,
                              const double error = 0.0);
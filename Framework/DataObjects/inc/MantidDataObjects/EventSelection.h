@@ -0,0 +1,71 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+class EventList;
+
+/** @class Mantid::DataObjects::EventSelection
+
+  A selection of the events of another EventList, given as ranges of indices
+  into its events. The selected list (the parent) is shared and must not be
+  modified. When an EventList is split lazily its events are moved, not
+  copied, into the parent, and the split list itself selects all of them.
+
+  An EventList holding a selection has no events of its own. Its histogram,
+  size and event values are read from the parent; the selected events are
+  only copied into the list when it is modified or sorted, or when a
+  reference to its event vector is asked for (see EventList::unpackColumns()).
+  Many EventLists, e.g. the outputs of FilterEvents for one spectrum, can
+  thus refer to the events of one list for the cost of their ranges.
+*/
+class MANTID_DATAOBJECTS_DLL EventSelection {
+public:
+  /// Indices [first, second) of events of the parent list
+  using Range = std::pair<std::size_t, std::size_t>;
+
+  EventSelection(std::shared_ptr<const EventList> parent,
+                 std::vector<Range> ranges);
+
+  /// The list whose events are selected
+  const EventList &parent() const { return *m_parent; }
+  /// The shared pointer to the list whose events are selected
+  const std::shared_ptr<const EventList> &sharedParent() const {
+    return m_parent;
+  }
+  /// The selected ranges of events, sorted and disjoint
+  const std::vector<Range> &ranges() const { return m_ranges; }
+  /// Number of events selected
+  std::size_t size() const { return m_size; }
+  /// True if every event of the parent is selected
+  bool isComplete() const;
+  /// True if the parent is referred to by another selection or list
+  bool isParentShared() const { return m_parent.use_count() > 1; }
+  /// Memory used by the selection, not including the parent
+  std::size_t getMemorySize() const {
+    return sizeof(EventSelection) + m_ranges.capacity() * sizeof(Range);
+  }
+
+private:
+  /// The list whose events are selected
+  std::shared_ptr<const EventList> m_parent;
+  /// The selected ranges of events
+  std::vector<Range> m_ranges;
+  /// Number of events selected
+  std::size_t m_size;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
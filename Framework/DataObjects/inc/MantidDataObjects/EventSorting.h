@@ -0,0 +1,185 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#ifdef _MSC_VER
+// qualifier applied to function type has no meaning; ignored
+#pragma warning(disable : 4180)
+#endif
+#include "tbb/parallel_sort.h"
+#ifdef _MSC_VER
+#pragma warning(default : 4180)
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+/** Sorting algorithms for the event vectors of EventList.
+
+  Event lists are often already sorted, or made of a few sorted runs (e.g. the
+  pulse times of events appended bank by bank), and their keys (TOF, pulse
+  time) are bounded numbers. sort() picks between:
+    - std::sort for short lists;
+    - merging the sorted runs when there are only a few of them;
+    - a parallel comparison sort for very long lists;
+    - a stable LSD radix sort on the bits of the key otherwise.
+*/
+namespace EventSorting {
+
+/// Lists shorter than this are sorted with std::sort
+constexpr std::size_t SMALL_LIST_SIZE = 256;
+/// Lists made of at most this many sorted runs are merged rather than sorted
+constexpr std::size_t MAX_SORTED_RUNS = 8;
+/// Lists at least this long are sorted with a parallel comparison sort
+constexpr std::size_t PARALLEL_SORT_SIZE = std::size_t{1} << 22;
+
+/// Map a double onto an unsigned integer with the same ordering
+inline uint64_t radixKey(const double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  constexpr uint64_t signBit = uint64_t{1} << 63;
+  return (bits & signBit) ? ~bits : (bits | signBit);
+}
+
+/// Map a signed integer onto an unsigned integer with the same ordering
+inline uint64_t radixKey(const int64_t value) {
+  return static_cast<uint64_t>(value) ^ (uint64_t{1} << 63);
+}
+
+/** Stable LSD radix sort of events on 8 bit digits of a 64 bit key. Digits
+ * that are the same for all events are skipped, so bounded keys such as TOFs
+ * only need a few passes.
+ * @param events :: the events to sort
+ * @param key :: functor returning the radix key of an event, see radixKey()
+ */
+template <typename T, typename KEY>
+void radixSort(std::vector<T> &events, KEY key) {
+  const std::size_t numEvents = events.size();
+  if (numEvents < 2)
+    return;
+  constexpr std::size_t numDigits = sizeof(uint64_t);
+  std::vector<uint64_t> keys(numEvents);
+  std::array<std::array<std::size_t, 256>, numDigits> counts{};
+  for (std::size_t i = 0; i < numEvents; ++i) {
+    const uint64_t value = key(events[i]);
+    keys[i] = value;
+    for (std::size_t digit = 0; digit < numDigits; ++digit)
+      ++counts[digit][(value >> (8 * digit)) & 0xff];
+  }
+
+  std::vector<T> sortedEvents;
+  std::vector<uint64_t> sortedKeys;
+  for (std::size_t digit = 0; digit < numDigits; ++digit) {
+    const auto shift = 8 * digit;
+    auto &offsets = counts[digit];
+    // Nothing to do if every event has the same value for this digit
+    if (offsets[(keys.front() >> shift) & 0xff] == numEvents)
+      continue;
+    std::size_t offset = 0;
+    for (auto &count : offsets) {
+      const auto bucketSize = count;
+      count = offset;
+      offset += bucketSize;
+    }
+    if (sortedEvents.empty()) {
+      sortedEvents.resize(numEvents);
+      sortedKeys.resize(numEvents);
+    }
+    for (std::size_t i = 0; i < numEvents; ++i) {
+      const auto destination = offsets[(keys[i] >> shift) & 0xff]++;
+      sortedEvents[destination] = events[i];
+      sortedKeys[destination] = keys[i];
+    }
+    events.swap(sortedEvents);
+    keys.swap(sortedKeys);
+  }
+}
+
+/** Sort the events by merging their sorted runs, if there are only a few.
+ * @param events :: the events to sort
+ * @param compare :: strict weak ordering of the events
+ * @return false, leaving the events untouched, if there are more than
+ * MAX_SORTED_RUNS runs.
+ */
+template <typename T, typename COMPARE>
+bool mergeSortedRuns(std::vector<T> &events, COMPARE compare) {
+  // Boundaries of the runs, including both ends of the vector
+  std::vector<std::size_t> bounds{0};
+  for (std::size_t i = 1; i < events.size(); ++i) {
+    if (compare(events[i], events[i - 1])) {
+      if (bounds.size() == MAX_SORTED_RUNS)
+        return false;
+      bounds.emplace_back(i);
+    }
+  }
+  bounds.emplace_back(events.size());
+
+  // Merge neighbouring runs until only one is left
+  const auto begin = events.begin();
+  while (bounds.size() > 2) {
+    std::vector<std::size_t> merged{0};
+    std::size_t run = 0;
+    for (; run + 2 < bounds.size(); run += 2) {
+      std::inplace_merge(begin + bounds[run], begin + bounds[run + 1],
+                         begin + bounds[run + 2], compare);
+      merged.emplace_back(bounds[run + 2]);
+    }
+    if (run + 1 < bounds.size())
+      merged.emplace_back(bounds.back());
+    bounds.swap(merged);
+  }
+  return true;
+}
+
+/** Sort the events, picking the strategy from the size of the list and how
+ * sorted it already is.
+ * @param events :: the events to sort
+ * @param compare :: strict weak ordering of the events
+ * @param key :: functor returning a radix key ordered like compare
+ */
+template <typename T, typename COMPARE, typename KEY>
+void sort(std::vector<T> &events, COMPARE compare, KEY key) {
+  if (events.size() < SMALL_LIST_SIZE)
+    std::sort(events.begin(), events.end(), compare);
+  else if (mergeSortedRuns(events, compare))
+    return;
+  else if (events.size() >= PARALLEL_SORT_SIZE)
+    tbb::parallel_sort(events.begin(), events.end(), compare);
+  else
+    radixSort(events, key);
+}
+
+/** Sort the events on a secondary criterion within each group of consecutive
+ * events that are equivalent for the primary one. The groups must already be
+ * contiguous, e.g. events sorted by pulse time are sorted by TOF within each
+ * pulse.
+ * @param events :: the events to sort
+ * @param sameGroup :: functor returning true if two events are in one group
+ * @param compare :: strict weak ordering within a group
+ */
+template <typename T, typename SAME_GROUP, typename COMPARE>
+void sortWithinGroups(std::vector<T> &events, SAME_GROUP sameGroup,
+                      COMPARE compare) {
+  auto first = events.begin();
+  while (first != events.end()) {
+    auto last = first + 1;
+    while (last != events.end() && sameGroup(*first, *last))
+      ++last;
+    if (!std::is_sorted(first, last, compare))
+      std::sort(first, last, compare);
+    first = last;
+  }
+}
+
+} // namespace EventSorting
+} // namespace DataObjects
+} // namespace Mantid
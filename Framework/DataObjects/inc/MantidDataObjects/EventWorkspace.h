@@ -143,12 +143,20 @@ public:
 
   void clearMRU() const override;
 
+  EventWorkspaceMRU &getMRU() const;
+
   EventSortType getSortType() const;
 
   // Sort all event lists. Uses a parallelized algorithm
   void sortAll(EventSortType sortType, Mantid::API::Progress *prog) const;
   void sortAllOld(EventSortType sortType, Mantid::API::Progress *prog) const;
 
+  // Move the events of all lists to columnar storage
+  void packColumns();
+  // Move the events of all lists to compact columnar storage
+  void packCompactEvents(
+      const std::shared_ptr<const std::vector<int64_t>> &pulseTable);
+
   void getIntegratedSpectra(std::vector<double> &out, const double minX,
                             const double maxX,
                             const bool entireRange) const override;
@@ -165,13 +173,14 @@ private:
   }
 
   EventList &getSpectrumWithoutInvalidation(const size_t index) override;
+  void createEventLists(const EventList &el);
 
   /** A vector that holds the event list for each spectrum; the key is
    * the workspace index, which is not necessarily the pixelid.
    */
   std::vector<std::unique_ptr<EventList>> data;
 
-  /// Container for the MRU lists of the event lists contained.
+  /// Cache of the histograms of the event lists contained.
   mutable std::unique_ptr<EventWorkspaceMRU> mru;
 };
 
@@ -8,14 +8,18 @@
 
 #include "MantidHistogramData/HistogramE.h"
 #include "MantidHistogramData/HistogramY.h"
-#include "MantidKernel/Exception.h"
-#include "MantidKernel/MRUList.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/cow_ptr.h"
 
 #include "Poco/RWLock.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace Mantid {
@@ -25,78 +29,111 @@ class EventList;
 
 //============================================================================
 //============================================================================
-/**
- * This little class holds data and an index marker that is used for uniqueness.
- * This is used in the MRUList.
- */
-template <class T> class TypeWithMarker {
-public:
-  /**
-   * Constructor.
-   * @param the_index :: unique index into the workspace of this data
-   */
-  TypeWithMarker(const uintptr_t the_index) : m_index(the_index) {}
-  TypeWithMarker(const TypeWithMarker &other) = delete;
-  TypeWithMarker &operator=(const TypeWithMarker &other) = delete;
-
-public:
-  /// Unique index value.
-  uintptr_t m_index;
-
-  /// Pointer to a vector of data
-  T m_data;
-
-  /// Function returns a unique index, used for hashing for MRU list
-  uintptr_t hashIndexFunction() const { return m_index; }
-
-  /// Set the unique index value.
-  void setIndex(const uintptr_t the_index) { m_index = the_index; }
-};
-
-//============================================================================
-//============================================================================
-/** This is a container for the MRU (most-recently-used) list
- * of generated histograms.
+/** This is the cache of the histograms generated from the event lists of an
+ * EventWorkspace.
+ *
+ * The cache is shared by all threads and split in shards, chosen from the
+ * address of the event list, so that threads reading different spectra rarely
+ * wait for each other. The memory budget is split evenly between the shards,
+ * and each shard drops its own least recently used histograms once it uses
+ * more than its share, so a thread only ever locks the shard it uses. Each
+ * histogram is stored with the version of the event list it was generated
+ * from, and is not returned once the list has changed.
+ *
+ * EventList::y() and similar return references rather than shared pointers, so
+ * the histograms last returned to each thread are also pinned: they stay
+ * valid for the next PINS_PER_THREAD histograms read in that thread, even if
+ * the cache drops them.
  */
 class DLLExport EventWorkspaceMRU {
 public:
   using YType = Kernel::cow_ptr<HistogramData::HistogramY>;
   using EType = Kernel::cow_ptr<HistogramData::HistogramE>;
-  using YWithMarker = TypeWithMarker<YType>;
-  using EWithMarker = TypeWithMarker<EType>;
-  // Typedef for a Most-Recently-Used list of Data objects.
-  using mru_listY = Kernel::MRUList<YWithMarker>;
-  using mru_listE = Kernel::MRUList<EWithMarker>;
 
-  ~EventWorkspaceMRU();
+  /// Number of histograms pinned for each thread
+  static constexpr size_t PINS_PER_THREAD = 50;
+  /// Number of shards the cache and its memory budget are split in
+  static constexpr size_t NUM_SHARDS = 16;
 
-  void ensureEnoughBuffersY(size_t thread_num) const;
-  void ensureEnoughBuffersE(size_t thread_num) const;
+  EventWorkspaceMRU();
+  explicit EventWorkspaceMRU(const size_t memoryBudget);
 
   void clear();
 
-  YType findY(size_t thread_num, const EventList *index);
-  EType findE(size_t thread_num, const EventList *index);
-  void insertY(size_t thread_num, YType data, const EventList *index);
-  void insertE(size_t thread_num, EType data, const EventList *index);
+  YType findY(const EventList *index, const uint64_t version);
+  EType findE(const EventList *index, const uint64_t version);
+  void insertY(YType data, const EventList *index, const uint64_t version);
+  void insertE(EType data, const EventList *index, const uint64_t version);
+
+  void pinY(const size_t thread_num, YType data);
+  void pinE(const size_t thread_num, EType data);
 
   void deleteIndex(const EventList *index);
 
-  /** Return how many entries in the Y MRU list are used.
-   * Only used in tests. It only returns the 0-th MRU list size.
-   * @return :: number of entries in the MRU list. */
+  /** Return how many event lists have histograms in the cache.
+   * @return :: number of entries in the cache. */
   size_t MRUSize() const;
 
-protected:
-  /// The most-recently-used list of dataY histograms
-  mutable std::vector<std::unique_ptr<mru_listY>> m_bufferedDataY;
-
-  /// The most-recently-used list of dataE histograms
-  mutable std::vector<std::unique_ptr<mru_listE>> m_bufferedDataE;
-
-  /// Mutex when adding entries in the MRU list
-  mutable Poco::RWLock m_changeMruListsMutexE;
-  mutable Poco::RWLock m_changeMruListsMutexY;
+  /// Memory used by the cached histograms, in bytes
+  size_t memorySize() const { return m_memorySize; }
+  /// Memory the cached histograms may use, in bytes
+  size_t memoryBudget() const { return m_memoryBudget; }
+  void setMemoryBudget(const size_t memoryBudget);
+
+  /// Number of histograms found in the cache
+  size_t hits() const { return m_hits; }
+  /// Number of histograms looked for and not found in the cache
+  size_t misses() const { return m_misses; }
+
+private:
+  /// The histograms generated from one event list
+  struct Entry {
+    const EventList *index;
+    uint64_t version;
+    YType y;
+    EType e;
+    size_t bytes;
+  };
+
+  /// A part of the cache, with its entries most recently used first
+  struct Shard {
+    mutable std::mutex mutex;
+    std::list<Entry> entries;
+    std::unordered_map<const EventList *, std::list<Entry>::iterator> lookup;
+    /// Memory used by the histograms of the shard, in bytes
+    size_t memorySize = 0;
+  };
+
+  /// The histograms last returned to a thread
+  struct Pins {
+    std::mutex mutex;
+    std::array<YType, PINS_PER_THREAD> y;
+    std::array<EType, PINS_PER_THREAD> e;
+    size_t nextY = 0;
+    size_t nextE = 0;
+  };
+
+  size_t shardIndex(const EventList *index) const;
+  Entry *findEntry(Shard &shard, const EventList *index,
+                   const uint64_t version);
+  Entry &entryToInsert(Shard &shard, const EventList *index,
+                       const uint64_t version);
+  void eraseEntry(Shard &shard, std::list<Entry>::iterator entry);
+  void updateMemory(Shard &shard, Entry &entry);
+  void evict(Shard &shard, const EventList *keep);
+  Pins &pinsFor(const size_t thread_num);
+
+  std::array<Shard, NUM_SHARDS> m_shards;
+
+  /// Pinned histograms, for each thread
+  std::vector<std::unique_ptr<Pins>> m_pins;
+  /// Mutex when adding pins for more threads
+  mutable Poco::RWLock m_pinsMutex;
+
+  std::atomic<size_t> m_memoryBudget;
+  std::atomic<size_t> m_memorySize{0};
+  std::atomic<size_t> m_hits{0};
+  std::atomic<size_t> m_misses{0};
 };
 
 } // namespace DataObjects
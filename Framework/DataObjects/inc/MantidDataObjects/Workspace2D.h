@@ -94,8 +94,10 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<std::unique_ptr<Histogram1D>> data;
+  /// The 1D histograms. Only the Histogram1D objects are adjacent: the X, Y
+  /// and E of each histogram are separate vectors, the Y and E shared when
+  /// initialized and copied only when written to.
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
@@ -0,0 +1,98 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventBinner.h"
+
+#include <cmath>
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/// Largest deviation of an edge from the closed form, as a fraction of a step
+constexpr double STEP_TOLERANCE = 1e-6;
+} // namespace
+
+/** Constructor. Works out how the bin edges are spaced.
+ * @param X :: the bin edges. They must outlive the EventBinner.
+ */
+EventBinner::EventBinner(const MantidVec &X)
+    : m_X(X), m_spacing(Spacing::Arbitrary), m_numBins(0), m_inverseStep(0.) {
+  if (X.size() < 2 || !(X.back() > X.front()))
+    return;
+  m_numBins = static_cast<int64_t>(X.size() - 1);
+  const auto numBins = static_cast<double>(m_numBins);
+
+  const double step = (X.back() - X.front()) / numBins;
+  bool linear = true;
+  for (size_t i = 1; i < X.size() - 1 && linear; ++i)
+    linear = std::abs(X[i] - (X.front() + static_cast<double>(i) * step)) <=
+             STEP_TOLERANCE * step;
+  if (linear) {
+    m_spacing = Spacing::Linear;
+    m_inverseStep = 1. / step;
+    return;
+  }
+
+  if (X.front() <= 0.)
+    return;
+  // Logarithmic edges have a constant ratio between neighbours
+  const double ratio = std::pow(X.back() / X.front(), 1. / numBins);
+  bool logarithmic = ratio > 1.;
+  for (size_t i = 1; i < X.size() && logarithmic; ++i)
+    logarithmic = std::abs(X[i] / X[i - 1] - ratio) <=
+                  STEP_TOLERANCE * (ratio - 1.);
+  if (logarithmic) {
+    m_spacing = Spacing::Logarithmic;
+    m_inverseStep = 1. / std::log(ratio);
+  }
+}
+
+/** Find the bins of a block of values.
+ * @param values :: the values to bin
+ * @param count :: the number of values
+ * @param bins :: receives the bin of each value, or -1 if it is outside the
+ * histogram
+ */
+void EventBinner::findBins(const double *values, const std::size_t count,
+                           int64_t *bins) const {
+  const auto numBins = static_cast<double>(m_numBins);
+  const double origin = m_X.front();
+  // Closed form. NaNs and values below the first edge give -1.
+  if (m_spacing == Spacing::Linear) {
+    for (std::size_t i = 0; i < count; ++i) {
+      const double position = (values[i] - origin) * m_inverseStep;
+      bins[i] = position >= 0.
+                    ? (position < numBins ? static_cast<int64_t>(position)
+                                          : m_numBins)
+                    : -1;
+    }
+  } else {
+    for (std::size_t i = 0; i < count; ++i) {
+      const double position = std::log(values[i] / origin) * m_inverseStep;
+      bins[i] = position >= 0.
+                    ? (position < numBins ? static_cast<int64_t>(position)
+                                          : m_numBins)
+                    : -1;
+    }
+  }
+
+  // Rounding in the closed form can put a value next to its true bin
+  for (std::size_t i = 0; i < count; ++i) {
+    auto bin = bins[i];
+    if (bin < 0)
+      continue;
+    const double value = values[i];
+    if (value < m_X[bin])
+      --bin;
+    else if (bin < m_numBins && value >= m_X[bin + 1])
+      ++bin;
+    bins[i] = bin < m_numBins ? bin : -1;
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -0,0 +1,436 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventColumns.h"
+
+#ifdef _MSC_VER
+// qualifier applied to function type has no meaning; ignored
+#pragma warning(disable : 4180)
+#endif
+#include "tbb/parallel_sort.h"
+#ifdef _MSC_VER
+#pragma warning(default : 4180)
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataObjects {
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+
+namespace {
+/** Walk a TOF-sorted column and the bin edges together, calling
+ * binEvent(bin, eventIndex) for every event that falls inside the histogram.
+ * Bins are half open, [X[i], X[i+1]), as in EventList::generateHistogram.
+ * @param tof :: time-of-flight column, sorted in increasing order
+ * @param X :: bin edges
+ * @param binEvent :: functor accumulating an event into a bin
+ */
+template <typename TOF, class BINNER>
+void walkSortedTofs(const std::vector<TOF> &tof, const MantidVec &X,
+                    BINNER binEvent) {
+  const auto first = std::lower_bound(tof.cbegin(), tof.cend(), X.front());
+  auto itx = X.cbegin();
+  for (auto it = first; it != tof.cend(); ++it) {
+    const auto value = static_cast<double>(*it);
+    itx = std::find_if(itx, X.cend(),
+                       [value](const double x) { return value < x; });
+    if (itx == X.cend())
+      break;
+    binEvent(static_cast<size_t>(std::distance(X.cbegin(), itx) - 1),
+             static_cast<size_t>(std::distance(tof.cbegin(), it)));
+  }
+}
+
+/** Reorder a column according to a permutation
+ * @param column :: the column to reorder. Empty columns are left untouched.
+ * @param order :: order[i] is the current index of the element that should
+ * end up at position i
+ */
+template <typename T>
+void permute(std::vector<T> &column, const std::vector<size_t> &order) {
+  if (column.empty())
+    return;
+  std::vector<T> sorted;
+  sorted.reserve(column.size());
+  for (const auto index : order)
+    sorted.emplace_back(column[index]);
+  column.swap(sorted);
+}
+
+/// Append the [first, last) slice of a column to another one
+template <typename T>
+void appendSlice(const std::vector<T> &column, const size_t first,
+                 const size_t last, std::vector<T> &output) {
+  if (column.empty())
+    return;
+  output.insert(output.end(), column.cbegin() + first, column.cbegin() + last);
+}
+} // namespace
+
+/// Constructor for an empty set of TOF event columns
+EventColumns::EventColumns() : m_eventType(API::TOF), m_compact(false) {}
+
+/** Constructor packing TofEvent's into columns
+ * @param events :: the events to pack
+ */
+EventColumns::EventColumns(const std::vector<TofEvent> &events)
+    : m_eventType(API::TOF), m_compact(false) {
+  m_tof.reserve(events.size());
+  m_pulseTime.reserve(events.size());
+  for (const auto &event : events) {
+    m_tof.emplace_back(event.tof());
+    m_pulseTime.emplace_back(event.pulseTime().totalNanoseconds());
+  }
+}
+
+/** Constructor packing WeightedEvent's into columns
+ * @param events :: the events to pack
+ */
+EventColumns::EventColumns(const std::vector<WeightedEvent> &events)
+    : m_eventType(API::WEIGHTED), m_compact(false) {
+  m_tof.reserve(events.size());
+  m_pulseTime.reserve(events.size());
+  m_weight.reserve(events.size());
+  m_errorSquared.reserve(events.size());
+  for (const auto &event : events) {
+    m_tof.emplace_back(event.tof());
+    m_pulseTime.emplace_back(event.pulseTime().totalNanoseconds());
+    m_weight.emplace_back(event.m_weight);
+    m_errorSquared.emplace_back(event.m_errorSquared);
+  }
+}
+
+/** Constructor packing WeightedEventNoTime's into columns
+ * @param events :: the events to pack
+ */
+EventColumns::EventColumns(const std::vector<WeightedEventNoTime> &events)
+    : m_eventType(API::WEIGHTED_NOTIME), m_compact(false) {
+  m_tof.reserve(events.size());
+  m_weight.reserve(events.size());
+  m_errorSquared.reserve(events.size());
+  for (const auto &event : events) {
+    m_tof.emplace_back(event.tof());
+    m_weight.emplace_back(event.m_weight);
+    m_errorSquared.emplace_back(event.m_errorSquared);
+  }
+}
+
+/** Memory used by the columns. As for EventList, this reports the CAPACITY of
+ * the vectors.
+ * @return :: the memory used, in bytes.
+ */
+std::size_t EventColumns::getMemorySize() const {
+  return m_tof.capacity() * sizeof(double) +
+         m_pulseTime.capacity() * sizeof(int64_t) +
+         m_weight.capacity() * sizeof(float) +
+         m_errorSquared.capacity() * sizeof(float) +
+         m_compactTof.capacity() * sizeof(float) +
+         m_pulseIndex.capacity() * sizeof(uint32_t) + sizeof(EventColumns);
+}
+
+/** Switch to the compact encoding: the time-of-flight is stored in single
+ * precision, which is the precision of the event_time_offset field of NeXus
+ * files, and the pulse time by its index in a pulse table. The table is not
+ * included in getMemorySize() since it is meant to be shared.
+ *
+ * If the table is null, too long to be indexed or does not hold the pulse time
+ * of every event, a table of the pulse times of these events is used instead.
+ * The columns are left unchanged in the unlikely case that this table is still
+ * too long to be indexed.
+ *
+ * @param pulseTable :: sorted, unique pulse times in nanoseconds that should
+ * contain the pulse time of every event.
+ */
+void EventColumns::compact(std::shared_ptr<const PulseTable> pulseTable) {
+  if (m_compact)
+    return;
+
+  std::vector<uint32_t> pulseIndex;
+  if (m_eventType != API::WEIGHTED_NOTIME) {
+    if (!indexPulseTimes(pulseTable, pulseIndex)) {
+      auto table = std::make_shared<PulseTable>(m_pulseTime);
+      std::sort(table->begin(), table->end());
+      table->erase(std::unique(table->begin(), table->end()), table->end());
+      pulseTable = std::move(table);
+      if (!indexPulseTimes(pulseTable, pulseIndex))
+        return;
+    }
+  } else {
+    // There are no pulse times to index
+    pulseTable.reset();
+  }
+
+  std::vector<float> compactTof(m_tof.cbegin(), m_tof.cend());
+  m_compactTof.swap(compactTof);
+  m_pulseIndex.swap(pulseIndex);
+  m_pulseTable = std::move(pulseTable);
+  std::vector<double>().swap(m_tof);
+  std::vector<int64_t>().swap(m_pulseTime);
+  m_compact = true;
+}
+
+/** Find the index of the pulse time of every event in a pulse table
+ * @param pulseTable :: sorted, unique pulse times in nanoseconds
+ * @param pulseIndex :: receives the index of the pulse time of each event
+ * @return :: false if the table is null, too long to be indexed or does not
+ * hold the pulse time of every event
+ */
+bool EventColumns::indexPulseTimes(
+    const std::shared_ptr<const PulseTable> &pulseTable,
+    std::vector<uint32_t> &pulseIndex) const {
+  pulseIndex.clear();
+  if (!pulseTable ||
+      pulseTable->size() > std::numeric_limits<uint32_t>::max())
+    return false;
+  pulseIndex.reserve(m_pulseTime.size());
+  const auto begin = pulseTable->cbegin();
+  for (const auto pulseTime : m_pulseTime) {
+    const auto it = std::lower_bound(begin, pulseTable->cend(), pulseTime);
+    if (it == pulseTable->cend() || *it != pulseTime)
+      return false;
+    pulseIndex.emplace_back(static_cast<uint32_t>(std::distance(begin, it)));
+  }
+  return true;
+}
+
+/** Unpack the columns into a vector of TofEvent's. Any existing contents of
+ * the output are replaced.
+ * @param events :: output vector
+ * @throw std::runtime_error if the columns do not hold TofEvent's
+ */
+void EventColumns::unpack(std::vector<TofEvent> &events) const {
+  if (m_eventType != API::TOF)
+    throw std::runtime_error("EventColumns::unpack() called with TofEvent's "
+                             "for columns holding weighted events.");
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tofAt(i), DateAndTime(pulseTimeAt(i)));
+}
+
+/** Unpack the columns into a vector of WeightedEvent's. Any existing contents
+ * of the output are replaced.
+ * @param events :: output vector
+ * @throw std::runtime_error if the columns do not hold WeightedEvent's
+ */
+void EventColumns::unpack(std::vector<WeightedEvent> &events) const {
+  if (m_eventType != API::WEIGHTED)
+    throw std::runtime_error("EventColumns::unpack() called with "
+                             "WeightedEvent's for columns of another type.");
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tofAt(i), DateAndTime(pulseTimeAt(i)), m_weight[i],
+                        m_errorSquared[i]);
+}
+
+/** Unpack the columns into a vector of WeightedEventNoTime's. Any existing
+ * contents of the output are replaced.
+ * @param events :: output vector
+ * @throw std::runtime_error if the columns do not hold WeightedEventNoTime's
+ */
+void EventColumns::unpack(std::vector<WeightedEventNoTime> &events) const {
+  if (m_eventType != API::WEIGHTED_NOTIME)
+    throw std::runtime_error("EventColumns::unpack() called with "
+                             "WeightedEventNoTime's for columns of another "
+                             "type.");
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < size(); ++i)
+    events.emplace_back(tofAt(i), m_weight[i], m_errorSquared[i]);
+}
+
+/** Sort all columns by the values of one of them. Only the key column is read
+ * to determine the order; the others are gathered once afterwards.
+ * @param key :: the column to sort by
+ */
+template <typename KEY>
+void EventColumns::sortByColumn(const std::vector<KEY> &key) {
+  if (std::is_sorted(key.cbegin(), key.cend()))
+    return;
+  std::vector<size_t> order(key.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  tbb::parallel_sort(order.begin(), order.end(),
+                     [&key](const size_t lhs, const size_t rhs) {
+                       return key[lhs] < key[rhs];
+                     });
+  // The key is one of the columns, so it must not be read from here on.
+  permute(m_tof, order);
+  permute(m_pulseTime, order);
+  permute(m_weight, order);
+  permute(m_errorSquared, order);
+  permute(m_compactTof, order);
+  permute(m_pulseIndex, order);
+}
+
+/// Sort the events by time-of-flight
+void EventColumns::sortTof() {
+  if (m_compact)
+    sortByColumn(m_compactTof);
+  else
+    sortByColumn(m_tof);
+}
+
+/// Sort the events by pulse time. Does nothing for WEIGHTED_NOTIME.
+void EventColumns::sortPulseTime() {
+  if (m_eventType == API::WEIGHTED_NOTIME)
+    return;
+  // The pulse table is sorted, so the indices sort like the times.
+  if (m_compact)
+    sortByColumn(m_pulseIndex);
+  else
+    sortByColumn(m_pulseTime);
+}
+
+/// Reverse the order of the events in every column
+void EventColumns::reverse() {
+  std::reverse(m_tof.begin(), m_tof.end());
+  std::reverse(m_pulseTime.begin(), m_pulseTime.end());
+  std::reverse(m_weight.begin(), m_weight.end());
+  std::reverse(m_errorSquared.begin(), m_errorSquared.end());
+  std::reverse(m_compactTof.begin(), m_compactTof.end());
+  std::reverse(m_pulseIndex.begin(), m_pulseIndex.end());
+}
+
+/** Generate the Y and E histograms w.r.t TOF. The events must already be
+ * sorted by TOF. Only the TOF column (and the weight and error columns for
+ * weighted events) are read.
+ *
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error. This has no effect for weighted
+ *        events.
+ */
+void EventColumns::generateHistogram(const MantidVec &X, MantidVec &Y,
+                                     MantidVec &E, bool skipError) const {
+  if (X.size() <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    E.resize(0, 0);
+    return;
+  }
+  const size_t numBins = X.size() - 1;
+  Y.assign(numBins, 0.0);
+  const auto walk = [this, &X](auto binEvent) {
+    if (m_compact)
+      walkSortedTofs(m_compactTof, X, binEvent);
+    else
+      walkSortedTofs(m_tof, X, binEvent);
+  };
+
+  if (m_eventType == API::TOF) {
+    walk([&Y](const size_t bin, size_t) { ++Y[bin]; });
+    if (!skipError) {
+      E.resize(numBins);
+      std::transform(Y.cbegin(), Y.cend(), E.begin(),
+                     static_cast<double (*)(double)>(sqrt));
+    }
+    return;
+  }
+
+  // Errors are accumulated squared until the last step.
+  E.assign(numBins, 0.0);
+  walk([&](const size_t bin, const size_t i) {
+    Y[bin] += static_cast<double>(m_weight[i]);
+    E[bin] += static_cast<double>(m_errorSquared[i]);
+  });
+  std::transform(E.cbegin(), E.cend(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
+/** Convert the time of flight by tof'=tof*factor+offset. Only the TOF column
+ * is touched. The order of the events is not changed.
+ * @param factor :: The value to scale the time-of-flight by
+ * @param offset :: The value to shift the time-of-flight by
+ */
+void EventColumns::convertTof(const double factor, const double offset) {
+  for (auto &tof : m_tof)
+    tof = tof * factor + offset;
+  for (auto &tof : m_compactTof)
+    tof = static_cast<float>(static_cast<double>(tof) * factor + offset);
+}
+
+/** Convert the time of flight using an arbitrary function. Only the TOF column
+ * is touched. The order of the events is not changed.
+ * @param func :: Function to do the conversion.
+ */
+void EventColumns::convertTof(const std::function<double(double)> &func) {
+  std::transform(m_tof.cbegin(), m_tof.cend(), m_tof.begin(), func);
+  std::transform(m_compactTof.cbegin(), m_compactTof.cend(),
+                 m_compactTof.begin(), [&func](const float tof) {
+                   return static_cast<float>(func(static_cast<double>(tof)));
+                 });
+}
+
+/** Copy the events with start <= pulse time < stop into another set of
+ * columns. The events must already be sorted by pulse time; only the pulse
+ * time column is searched.
+ * @param start :: start time (absolute)
+ * @param stop :: end time (absolute)
+ * @param output :: the columns receiving the filtered events
+ * @throw std::runtime_error if the events have no pulse times
+ */
+void EventColumns::filterByPulseTime(const DateAndTime &start,
+                                     const DateAndTime &stop,
+                                     EventColumns &output) const {
+  if (m_eventType == API::WEIGHTED_NOTIME)
+    throw std::runtime_error("EventColumns::filterByPulseTime() called on "
+                             "events that have no time information.");
+  output = EventColumns();
+  output.m_eventType = m_eventType;
+  output.m_compact = m_compact;
+  output.m_pulseTable = m_pulseTable;
+
+  size_t firstIndex, lastIndex;
+  if (m_compact) {
+    // Translate the times into pulse indices, then search the index column
+    const auto &table = *m_pulseTable;
+    const auto startIndex = static_cast<uint32_t>(std::distance(
+        table.cbegin(), std::lower_bound(table.cbegin(), table.cend(),
+                                         start.totalNanoseconds())));
+    const auto stopIndex = static_cast<uint32_t>(std::distance(
+        table.cbegin(), std::lower_bound(table.cbegin(), table.cend(),
+                                         stop.totalNanoseconds())));
+    const auto begin = m_pulseIndex.cbegin();
+    const auto first = std::lower_bound(begin, m_pulseIndex.cend(), startIndex);
+    const auto last = std::lower_bound(first, m_pulseIndex.cend(), stopIndex);
+    firstIndex = static_cast<size_t>(std::distance(begin, first));
+    lastIndex = static_cast<size_t>(std::distance(begin, last));
+  } else {
+    const auto begin = m_pulseTime.cbegin();
+    const auto first =
+        std::lower_bound(begin, m_pulseTime.cend(), start.totalNanoseconds());
+    const auto last =
+        std::lower_bound(first, m_pulseTime.cend(), stop.totalNanoseconds());
+    firstIndex = static_cast<size_t>(std::distance(begin, first));
+    lastIndex = static_cast<size_t>(std::distance(begin, last));
+  }
+
+  appendSlice(m_tof, firstIndex, lastIndex, output.m_tof);
+  appendSlice(m_pulseTime, firstIndex, lastIndex, output.m_pulseTime);
+  appendSlice(m_weight, firstIndex, lastIndex, output.m_weight);
+  appendSlice(m_errorSquared, firstIndex, lastIndex, output.m_errorSquared);
+  appendSlice(m_compactTof, firstIndex, lastIndex, output.m_compactTof);
+  appendSlice(m_pulseIndex, firstIndex, lastIndex, output.m_pulseIndex);
+}
+
+/** Append the time-of-flight of every event to a vector
+ * @param tofs :: the vector receiving the values
+ */
+void EventColumns::getTofs(std::vector<double> &tofs) const {
+  tofs.insert(tofs.end(), m_tof.cbegin(), m_tof.cend());
+  tofs.insert(tofs.end(), m_compactTof.cbegin(), m_compactTof.cend());
+}
+
+} // namespace DataObjects
+} // namespace Mantid
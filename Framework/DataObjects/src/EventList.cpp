@@ -6,6 +6,9 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventList.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidDataObjects/EventBinner.h"
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventSorting.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidKernel/DateAndTime.h"
@@ -18,6 +21,7 @@
 // qualifier applied to function type has no meaning; ignored
 #pragma warning(disable : 4180)
 #endif
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_sort.h"
 #ifdef _MSC_VER
 #pragma warning(default : 4180)
@@ -119,6 +123,162 @@ bool compareEventPulseTimeTOF(const TofEvent &e1, const TofEvent &e2) {
   return false;
 }
 
+namespace {
+/// Radix key ordering events by TOF
+template <typename T> uint64_t tofKey(const T &event) {
+  return EventSorting::radixKey(event.tof());
+}
+
+/// Radix key ordering events by pulse time
+template <typename T> uint64_t pulseTimeKey(const T &event) {
+  return EventSorting::radixKey(event.pulseTime().totalNanoseconds());
+}
+
+/// Append the events in the given ranges of a vector to another vector
+template <typename T>
+void copyRanges(const std::vector<T> &source,
+                const std::vector<EventSelection::Range> &ranges,
+                std::vector<T> &destination) {
+  size_t numEvents = 0;
+  for (const auto &range : ranges)
+    numEvents += range.second - range.first;
+  destination.reserve(destination.size() + numEvents);
+  for (const auto &range : ranges)
+    destination.insert(destination.end(), source.cbegin() + range.first,
+                       source.cbegin() + range.second);
+}
+
+/** Histogram events by TOF without sorting them.
+ * @param binner :: finds the bins of the events in closed form
+ * @param events :: the events, in any order
+ * @param X :: bin edges
+ * @param Y :: counts returned
+ * @param E :: errors returned
+ * @param skipError :: skip calculating the error of unweighted events
+ */
+void histogramUnsorted(const EventBinner &binner,
+                       const std::vector<TofEvent> &events, const MantidVec &X,
+                       MantidVec &Y, MantidVec &E, const bool skipError) {
+  Y.assign(X.size() - 1, 0.0);
+  binner.binEvents(
+      events, [](const TofEvent &event) { return event.tof(); },
+      [&Y](const size_t bin, const TofEvent &) { ++Y[bin]; });
+  if (!skipError) {
+    E.resize(Y.size());
+    std::transform(Y.cbegin(), Y.cend(), E.begin(),
+                   static_cast<double (*)(double)>(sqrt));
+  }
+}
+
+/// Histogram weighted events by TOF without sorting them. See above.
+template <typename T>
+void histogramUnsorted(const EventBinner &binner, const std::vector<T> &events,
+                       const MantidVec &X, MantidVec &Y, MantidVec &E, bool) {
+  Y.assign(X.size() - 1, 0.0);
+  // Errors are accumulated squared until the last step.
+  E.assign(X.size() - 1, 0.0);
+  binner.binEvents(events, [](const T &event) { return event.tof(); },
+                   [&Y, &E](const size_t bin, const T &event) {
+                     Y[bin] += event.weight();
+                     E[bin] += event.errorSquared();
+                   });
+  std::transform(E.cbegin(), E.cend(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
+/** Histogram ranges of events by TOF without sorting them.
+ * @param X :: bin edges
+ * @param events :: the events, in any order
+ * @param ranges :: the ranges of indices of the events to histogram
+ * @param Y :: counts returned
+ * @param E :: errors returned
+ */
+template <typename T>
+void histogramRanges(const MantidVec &X, const std::vector<T> &events,
+                     const std::vector<EventSelection::Range> &ranges,
+                     MantidVec &Y, MantidVec &E) {
+  if (X.size() < 2) {
+    Y.clear();
+    E.clear();
+    return;
+  }
+  Y.assign(X.size() - 1, 0.0);
+  // Errors are accumulated squared until the last step.
+  E.assign(X.size() - 1, 0.0);
+  const auto add = [&Y, &E](const size_t bin, const T &event) {
+    Y[bin] += event.weight();
+    E[bin] += event.errorSquared();
+  };
+  const EventBinner binner(X);
+  for (const auto &range : ranges) {
+    if (binner.isClosedForm()) {
+      binner.binEvents(events, range.first, range.second,
+                       [](const T &event) { return event.tof(); }, add);
+      continue;
+    }
+    for (size_t i = range.first; i < range.second; ++i) {
+      const double tof = events[i].tof();
+      if (tof < X.front() || tof >= X.back())
+        continue;
+      const auto edge = std::upper_bound(X.cbegin(), X.cend(), tof);
+      add(std::distance(X.cbegin(), edge) - 1, events[i]);
+    }
+  }
+  std::transform(E.cbegin(), E.cend(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
+/// Compare two events' TOF
+template <typename T> bool compareTof(const T &e1, const T &e2) {
+  return e1.tof() < e2.tof();
+}
+
+/// Sort a vector of events by TOF
+template <typename T> void sortEventsByTof(std::vector<T> &events) {
+  EventSorting::sort(events, compareTof<T>, tofKey<T>);
+}
+
+/// Sort a vector of events by pulse time
+template <typename T> void sortEventsByPulseTime(std::vector<T> &events) {
+  EventSorting::sort(events, compareEventPulseTime, pulseTimeKey<T>);
+}
+
+/** Sort a vector of events by pulse time, then TOF, reusing the current order
+ * of the events where possible.
+ * @param events :: the events to sort
+ * @param currentOrder :: how the events are sorted at the moment
+ */
+template <typename T>
+void sortEventsByPulseTimeTOF(std::vector<T> &events,
+                              const EventSortType currentOrder) {
+  if (currentOrder == PULSETIME_SORT) {
+    // Only the events of each pulse need to be sorted
+    EventSorting::sortWithinGroups(
+        events,
+        [](const T &e1, const T &e2) {
+          return e1.pulseTime() == e2.pulseTime();
+        },
+        compareTof<T>);
+  } else if (currentOrder == TOF_SORT) {
+    // A stable sort by pulse time keeps the TOF order within each pulse
+    if (events.size() < EventSorting::SMALL_LIST_SIZE)
+      std::stable_sort(events.begin(), events.end(), compareEventPulseTime);
+    else if (!EventSorting::mergeSortedRuns(events, compareEventPulseTime))
+      EventSorting::radixSort(events, pulseTimeKey<T>);
+  } else if (events.size() < EventSorting::SMALL_LIST_SIZE) {
+    std::sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+  } else if (EventSorting::mergeSortedRuns(events, compareEventPulseTimeTOF)) {
+    return;
+  } else if (events.size() >= EventSorting::PARALLEL_SORT_SIZE) {
+    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+  } else {
+    // Two stable passes: the last key sorted on is the primary one
+    EventSorting::radixSort(events, tofKey<T>);
+    EventSorting::radixSort(events, pulseTimeKey<T>);
+  }
+}
+} // namespace
+
 // comparator for pulse time with tolerance
 struct comparePulseTimeTOFDelta {
   explicit comparePulseTimeTOFDelta(const Types::Core::DateAndTime &start,
@@ -228,8 +388,12 @@ void EventList::copyDataInto(EventList &sink) const {
   sink.events = events;
   sink.weightedEvents = weightedEvents;
   sink.weightedEventsNoTime = weightedEventsNoTime;
+  sink.m_columns =
+      m_columns ? std::make_unique<EventColumns>(*m_columns) : nullptr;
+  sink.m_selection = m_selection;
   sink.eventType = eventType;
   sink.order = order;
+  ++sink.m_version;
 }
 
 /// Used by Histogram1D::copyDataFrom for dynamic dispatch for `other`.
@@ -338,8 +502,12 @@ EventList &EventList::operator=(const EventList &rhs) {
   events = rhs.events;
   weightedEvents = rhs.weightedEvents;
   weightedEventsNoTime = rhs.weightedEventsNoTime;
+  m_columns =
+      rhs.m_columns ? std::make_unique<EventColumns>(*rhs.m_columns) : nullptr;
+  m_selection = rhs.m_selection;
   eventType = rhs.eventType;
   order = rhs.order;
+  ++m_version;
   return *this;
 }
 
@@ -349,7 +517,7 @@ EventList &EventList::operator=(const EventList &rhs) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const TofEvent &event) {
-
+  this->unpackColumns();
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -366,6 +534,7 @@ EventList &EventList::operator+=(const TofEvent &event) {
   }
 
   this->order = UNSORTED;
+  ++m_version;
   return *this;
 }
 
@@ -377,6 +546,7 @@ EventList &EventList::operator+=(const TofEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
+  this->unpackColumns();
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -405,6 +575,7 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
   }
 
   this->order = UNSORTED;
+  ++m_version;
   return *this;
 }
 
@@ -417,9 +588,11 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
+  this->unpackColumns();
   this->switchTo(WEIGHTED);
   this->weightedEvents.emplace_back(event);
   this->order = UNSORTED;
+  ++m_version;
   return *this;
 }
 
@@ -433,6 +606,7 @@ EventList &EventList::operator+=(const WeightedEvent &event) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEvent> &more_events) {
+  this->unpackColumns();
   switch (this->eventType) {
   case TOF:
     // Need to switch to weighted
@@ -457,6 +631,7 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
   }
 
   this->order = UNSORTED;
+  ++m_version;
   return *this;
 }
 
@@ -470,6 +645,7 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEventNoTime> &more_events) {
+  this->unpackColumns();
   switch (this->eventType) {
   case TOF:
   case WEIGHTED:
@@ -485,6 +661,7 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
   }
 
   this->order = UNSORTED;
+  ++m_version;
   return *this;
 }
 
@@ -498,18 +675,20 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const EventList &more_events) {
+  std::unique_ptr<EventList> selected;
+  const EventList &source = more_events.eventsToRead(selected);
   // We'll let the += operator for the given vector of event lists handle it
   switch (more_events.getEventType()) {
   case TOF:
-    this->operator+=(more_events.events);
+    this->operator+=(source.events);
     break;
 
   case WEIGHTED:
-    this->operator+=(more_events.weightedEvents);
+    this->operator+=(source.weightedEvents);
     break;
 
   case WEIGHTED_NOTIME:
-    this->operator+=(more_events.weightedEventsNoTime);
+    this->operator+=(source.weightedEventsNoTime);
     break;
   }
 
@@ -565,6 +744,8 @@ EventList &EventList::operator-=(const EventList &more_events) {
     this->clearData();
     return *this;
   }
+  this->unpackColumns();
+  more_events.unpackColumns();
 
   // We'll let the -= operator for the given vector of event lists handle it
   switch (this->getEventType()) {
@@ -604,6 +785,7 @@ EventList &EventList::operator-=(const EventList &more_events) {
 
   // No guaranteed order
   this->order = UNSORTED;
+  ++m_version;
 
   // NOTE: What to do about detector ID's?
   return *this;
@@ -615,6 +797,12 @@ EventList &EventList::operator-=(const EventList &more_events) {
  * @return :: true if equal.
  */
 bool EventList::operator==(const EventList &rhs) const {
+  if (m_selection || rhs.m_selection) {
+    std::unique_ptr<EventList> lhsSelected, rhsSelected;
+    return eventsToRead(lhsSelected) == rhs.eventsToRead(rhsSelected);
+  }
+  this->unpackColumns();
+  rhs.unpackColumns();
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
   if (this->eventType != rhs.eventType)
@@ -639,6 +827,13 @@ bool EventList::operator!=(const EventList &rhs) const {
 
 bool EventList::equals(const EventList &rhs, const double tolTof,
                        const double tolWeight, const int64_t tolPulse) const {
+  if (m_selection || rhs.m_selection) {
+    std::unique_ptr<EventList> lhsSelected, rhsSelected;
+    return eventsToRead(lhsSelected)
+        .equals(rhs.eventsToRead(rhsSelected), tolTof, tolWeight, tolPulse);
+  }
+  this->unpackColumns();
+  rhs.unpackColumns();
   // generic checks
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
@@ -687,6 +882,7 @@ EventType EventList::getEventType() const { return eventType; }
  * WEIGHTED_NOTIME)
  */
 void EventList::switchTo(EventType newType) {
+  this->unpackColumns();
   switch (newType) {
   case TOF:
     if (eventType != TOF)
@@ -779,6 +975,7 @@ void EventList::switchToWeightedEventsNoTime() {
  * @return a WeightedEvent
  */
 WeightedEvent EventList::getEvent(size_t event_number) {
+  this->unpackColumns();
   switch (eventType) {
   case TOF:
     return WeightedEvent(events[event_number]);
@@ -805,6 +1002,10 @@ WeightedEvent EventList::getEvent(size_t event_number) {
  * @return a const reference to the list of non-weighted events
  * */
 const std::vector<TofEvent> &EventList::getEvents() const {
+  // Only a selection of all of the parent's events has a vector to refer to
+  if (m_selection && m_selection->isComplete())
+    return m_selection->parent().getEvents();
+  this->unpackColumns();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
@@ -820,6 +1021,9 @@ const std::vector<TofEvent> &EventList::getEvents() const {
  * @return a reference to the list of non-weighted events
  * */
 std::vector<TofEvent> &EventList::getEvents() {
+  this->unpackColumns();
+  // The caller may change the events
+  ++m_version;
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
@@ -835,6 +1039,9 @@ std::vector<TofEvent> &EventList::getEvents() {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEvent> &EventList::getWeightedEvents() {
+  this->unpackColumns();
+  // The caller may change the events
+  ++m_version;
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
@@ -850,6 +1057,10 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
  * @return a const reference to the list of weighted events
  * */
 const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
+  // Only a selection of all of the parent's events has a vector to refer to
+  if (m_selection && m_selection->isComplete())
+    return m_selection->parent().getWeightedEvents();
+  this->unpackColumns();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
@@ -863,6 +1074,9 @@ const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
+  this->unpackColumns();
+  // The caller may change the events
+  ++m_version;
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEventNoTime. Use "
@@ -877,6 +1091,10 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
  * */
 const std::vector<WeightedEventNoTime> &
 EventList::getWeightedEventsNoTime() const {
+  // Only a selection of all of the parent's events has a vector to refer to
+  if (m_selection && m_selection->isComplete())
+    return m_selection->parent().getWeightedEventsNoTime();
+  this->unpackColumns();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for "
                              "an EventList not of type WeightedEventNoTime. "
@@ -890,6 +1108,9 @@ EventList::getWeightedEventsNoTime() const {
 void EventList::clear(const bool removeDetIDs) {
   if (mru)
     mru->deleteIndex(this);
+  ++m_version;
+  m_columns.reset();
+  m_selection.reset();
   this->events.clear();
   std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
   this->weightedEvents.clear();
@@ -940,6 +1161,7 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
  * @param num :: number of events that will be in this EventList
  */
 void EventList::reserve(size_t num) {
+  this->unpackColumns();
   switch (this->eventType) {
   case TOF:
     this->events.reserve(num);
@@ -994,6 +1216,7 @@ void EventList::setSortOrder(const EventSortType order) const {
 // --------------------------------------------------------------------------
 /** Sort events by TOF in one thread */
 void EventList::sortTof() const {
+  copySelectedEvents();
   if (this->order == TOF_SORT)
     return; // nothing to do
 
@@ -1003,16 +1226,21 @@ void EventList::sortTof() const {
   if (this->order == TOF_SORT)
     return;
 
+  if (m_columns) {
+    m_columns->sortTof();
+    this->order = TOF_SORT;
+    return;
+  }
+
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end());
+    sortEventsByTof(events);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end());
+    sortEventsByTof(weightedEvents);
     break;
   case WEIGHTED_NOTIME:
-    tbb::parallel_sort(weightedEventsNoTime.begin(),
-                       weightedEventsNoTime.end());
+    sortEventsByTof(weightedEventsNoTime);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1031,6 +1259,7 @@ void EventList::sortTof() const {
 void EventList::sortTimeAtSample(const double &tofFactor,
                                  const double &tofShift,
                                  bool forceResort) const {
+  this->unpackColumns();
   // Check pre-cached sort flag.
   if (this->order == TIMEATSAMPLE_SORT && !forceResort)
     return;
@@ -1065,6 +1294,7 @@ void EventList::sortTimeAtSample(const double &tofFactor,
 // --------------------------------------------------------------------------
 /** Sort events by Frame */
 void EventList::sortPulseTime() const {
+  copySelectedEvents();
   if (this->order == PULSETIME_SORT)
     return; // nothing to do
 
@@ -1074,14 +1304,19 @@ void EventList::sortPulseTime() const {
   if (this->order == PULSETIME_SORT)
     return;
 
+  if (m_columns) {
+    m_columns->sortPulseTime();
+    this->order = PULSETIME_SORT;
+    return;
+  }
+
   // Perform sort.
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
+    sortEventsByPulseTime(events);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTime);
+    sortEventsByPulseTime(weightedEvents);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1096,6 +1331,7 @@ void EventList::sortPulseTime() const {
  * (the absolute time)
  */
 void EventList::sortPulseTimeTOF() const {
+  this->unpackColumns();
   if (this->order == PULSETIMETOF_SORT)
     return; // already ordered.
 
@@ -1107,11 +1343,10 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    sortEventsByPulseTimeTOF(events, this->order);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTimeTOF);
+    sortEventsByPulseTimeTOF(weightedEvents, this->order);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1131,6 +1366,7 @@ void EventList::sortPulseTimeTOF() const {
  */
 void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                                       const double seconds) const {
+  this->unpackColumns();
   // Avoid sorting from multiple threads
   std::lock_guard<std::mutex> _lock(m_sortMutex);
 
@@ -1168,12 +1404,15 @@ EventSortType EventList::getSortType() const { return this->order; }
  * Does nothing if sorted otherwise or unsorted.
  * */
 void EventList::reverse() {
+  copySelectedEvents();
   // reverse the histogram bin parameters
   MantidVec &x = dataX();
   std::reverse(x.begin(), x.end());
 
   // flip the events if they are tof sorted
-  if (this->isSortedByTof()) {
+  if (this->isSortedByTof() && m_columns) {
+    m_columns->reverse();
+  } else if (this->isSortedByTof()) {
     switch (eventType) {
     case TOF:
       std::reverse(this->events.begin(), this->events.end());
@@ -1200,6 +1439,10 @@ void EventList::reverse() {
  * @return the number of events in the list.
  *  */
 size_t EventList::getNumberEvents() const {
+  if (m_selection)
+    return m_selection->size();
+  if (m_columns)
+    return m_columns->size();
   switch (eventType) {
   case TOF:
     return this->events.size();
@@ -1215,6 +1458,10 @@ size_t EventList::getNumberEvents() const {
  * Much like stl containers, returns true if there is nothing in the event list.
  */
 bool EventList::empty() const {
+  if (m_selection)
+    return m_selection->size() == 0;
+  if (m_columns)
+    return m_columns->empty();
   switch (eventType) {
   case TOF:
     return this->events.empty();
@@ -1229,11 +1476,21 @@ bool EventList::empty() const {
 // --------------------------------------------------------------------------
 /** Memory used by this event list. Note: It reports the CAPACITY of the
  * vectors, rather than their size, since that is a more accurate
- * representation of the size used.
+ * representation of the size used. A selection of all of the events of its
+ * parent, such as a list that was split lazily, counts the parent's events;
+ * other selections only count their ranges.
  *
  * @return :: the memory used by the EventList, in bytes.
  * */
 size_t EventList::getMemorySize() const {
+  if (m_selection) {
+    size_t parentSize = 0;
+    if (m_selection->isComplete())
+      parentSize = m_selection->parent().getMemorySize();
+    return m_selection->getMemorySize() + parentSize + sizeof(EventList);
+  }
+  if (m_columns)
+    return m_columns->getMemorySize() + sizeof(EventList);
   switch (eventType) {
   case TOF:
     return this->events.capacity() * sizeof(TofEvent) + sizeof(EventList);
@@ -1247,6 +1504,207 @@ size_t EventList::getMemorySize() const {
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
 
+// --------------------------------------------------------------------------
+/** Move the events into columnar (structure-of-arrays) storage.
+ *
+ * Sorting, histogramming, TOF conversion and filtering by pulse time then
+ * only stream the columns they need. Any other operation transparently
+ * converts the events back to the usual vector storage first.
+ * The memory of the event vectors is released.
+ * */
+void EventList::packColumns() {
+  if (m_columns)
+    return;
+  copySelectedEvents();
+  switch (eventType) {
+  case TOF:
+    m_columns = std::make_unique<EventColumns>(this->events);
+    std::vector<TofEvent>().swap(this->events);
+    break;
+  case WEIGHTED:
+    m_columns = std::make_unique<EventColumns>(this->weightedEvents);
+    std::vector<WeightedEvent>().swap(this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    m_columns = std::make_unique<EventColumns>(this->weightedEventsNoTime);
+    std::vector<WeightedEventNoTime>().swap(this->weightedEventsNoTime);
+    break;
+  }
+}
+
+// --------------------------------------------------------------------------
+/** Move the events into compact columnar storage: single precision TOF and
+ * an index into a table of pulse times, which is typically shared by all the
+ * event lists of a workspace. This roughly halves the memory used by
+ * TofEvent's.
+ *
+ * @param pulseTable :: sorted, unique pulse times in nanoseconds including
+ * the pulse time of every event. If it is null or misses a pulse time, a
+ * table is built for this list (see EventColumns::compact()).
+ * */
+void EventList::packCompactColumns(
+    std::shared_ptr<const std::vector<int64_t>> pulseTable) {
+  this->packColumns();
+  m_columns->compact(std::move(pulseTable));
+}
+
+// --------------------------------------------------------------------------
+/** Move the events back from columnar storage into the event vectors, and
+ * copy the events selected from another list, if any. Called by
+ * unpackColumns() when the events are not in the event vectors.
+ * */
+void EventList::unpackStorage() const {
+  copySelectedEvents();
+  if (!m_columns)
+    return;
+  // Avoid unpacking from multiple threads
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  // If the list was unpacked while waiting for the lock, return.
+  if (!m_columns)
+    return;
+  switch (eventType) {
+  case TOF:
+    m_columns->unpack(this->events);
+    break;
+  case WEIGHTED:
+    m_columns->unpack(this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    m_columns->unpack(this->weightedEventsNoTime);
+    break;
+  }
+  m_columns.reset();
+}
+
+// --------------------------------------------------------------------------
+/** Make the events of this list a selection of the events of another list.
+ * The selected events are read in place and only copied into this list when
+ * it is modified, so many lists can refer to the events of one list for the
+ * cost of the ranges. If this list already holds events, the selected events
+ * are added to them, as the += operator would: they stay a selection if the
+ * existing events are disjoint ranges of the same parent, otherwise they are
+ * copied. The detector IDs and histogram of this list are kept.
+ * @param parent :: the list to select events from. It must not be modified
+ * afterwards.
+ * @param ranges :: the ranges of indices of the selected events, sorted and
+ * disjoint
+ * @throw std::invalid_argument if the parent is this list or the ranges are
+ * invalid
+ * */
+void EventList::selectFrom(std::shared_ptr<const EventList> parent,
+                           std::vector<EventSelection::Range> ranges) {
+  if (parent.get() == this)
+    throw std::invalid_argument("An EventList cannot select its own events");
+  bool keepEvents = !this->empty();
+  if (m_selection && &m_selection->parent() == parent.get()) {
+    // Merge the ranges if they do not overlap the ones already selected
+    std::vector<EventSelection::Range> merged;
+    merged.reserve(m_selection->ranges().size() + ranges.size());
+    std::merge(m_selection->ranges().cbegin(), m_selection->ranges().cend(),
+               ranges.cbegin(), ranges.cend(), std::back_inserter(merged));
+    const auto overlap = std::adjacent_find(
+        merged.cbegin(), merged.cend(),
+        [](const EventSelection::Range &left,
+           const EventSelection::Range &right) {
+          return left.second > right.first;
+        });
+    if (overlap == merged.cend()) {
+      ranges = std::move(merged);
+      keepEvents = false;
+    }
+  }
+  auto selection = std::make_shared<const EventSelection>(std::move(parent),
+                                                         std::move(ranges));
+  if (keepEvents) {
+    // Keep the events already in the list and add copies of the selected ones
+    EventList selected;
+    selected.eventType = selection->parent().getEventType();
+    selected.appendSelectedEvents(*selection);
+    this->operator+=(selected);
+    return;
+  }
+  this->clear(false);
+  // Ranges of a sorted list keep its order
+  this->eventType = selection->parent().getEventType();
+  this->order = selection->parent().getSortType();
+  m_selection = std::move(selection);
+}
+
+// --------------------------------------------------------------------------
+/** Copy the events selected from another list into the event vectors.
+ * Does nothing if the events are not a selection. If nothing else refers to
+ * the parent and all of its events are selected, they are moved back into
+ * this list instead.
+ * */
+void EventList::copySelectedEvents() const {
+  if (!m_selection)
+    return;
+  // Avoid copying from multiple threads
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  // If the events were copied while waiting for the lock, return.
+  if (!m_selection)
+    return;
+  const EventList &parent = m_selection->parent();
+  parent.unpackColumns();
+  if (m_selection.use_count() == 1 && !m_selection->isParentShared() &&
+      m_selection->isComplete()) {
+    this->events.swap(parent.events);
+    this->weightedEvents.swap(parent.weightedEvents);
+    this->weightedEventsNoTime.swap(parent.weightedEventsNoTime);
+  } else {
+    appendSelectedEvents(*m_selection);
+  }
+  m_selection.reset();
+}
+
+// --------------------------------------------------------------------------
+/** Append copies of the events of a selection to the event vectors.
+ * @param selection :: selected events, of the same type as this list
+ * */
+void EventList::appendSelectedEvents(const EventSelection &selection) const {
+  const EventList &parent = selection.parent();
+  parent.unpackColumns();
+  switch (eventType) {
+  case TOF:
+    copyRanges(parent.events, selection.ranges(), this->events);
+    break;
+  case WEIGHTED:
+    copyRanges(parent.weightedEvents, selection.ranges(),
+               this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    copyRanges(parent.weightedEventsNoTime, selection.ranges(),
+               this->weightedEventsNoTime);
+    break;
+  }
+}
+
+// --------------------------------------------------------------------------
+/** Get a list whose event vectors hold the events of this list, for reading
+ * them without copying a selection into this list. That is this list itself
+ * unless it is a selection; the parent if all of its events are selected;
+ * otherwise a copy of the selected events. The returned list must not be
+ * sorted or modified unless it is the copy.
+ * @param copy :: holds the copy of the selected events, if one is needed
+ * @return the list holding the events
+ * */
+const EventList &
+EventList::eventsToRead(std::unique_ptr<EventList> &copy) const {
+  const auto selection = m_selection;
+  if (!selection) {
+    this->unpackColumns();
+    return *this;
+  }
+  selection->parent().unpackColumns();
+  if (selection->isComplete())
+    return selection->parent();
+  copy = std::make_unique<EventList>();
+  copy->eventType = eventType;
+  copy->order = order;
+  copy->appendSelectedEvents(*selection);
+  return *copy;
+}
+
 // --------------------------------------------------------------------------
 /** Return the size of the histogram data.
  * @return the size of the histogram representation of the data (size of Y) **/
@@ -1271,6 +1729,7 @@ void EventList::setX(const Kernel::cow_ptr<HistogramData::HistogramX> &X) {
   m_histogram.setX(X);
   if (mru)
     mru->deleteIndex(this);
+  ++m_version;
 }
 
 /** Deprecated, use mutableX() instead. Returns a reference to the x data.
@@ -1279,6 +1738,7 @@ void EventList::setX(const Kernel::cow_ptr<HistogramData::HistogramX> &X) {
 MantidVec &EventList::dataX() {
   if (mru)
     mru->deleteIndex(this);
+  ++m_version;
   return m_histogram.dataX();
 }
 
@@ -1367,26 +1827,29 @@ const HistogramData::HistogramY &EventList::y() const {
     throw std::runtime_error(
         "'EventList::y()' called with no MRU set. This is not allowed.");
 
-  return *sharedY();
+  auto yData = sharedY();
+  const auto &y = *yData;
+  // Keep the histogram alive while the caller holds the reference
+  mru->pinY(PARALLEL_THREAD_NUMBER, std::move(yData));
+  return y;
 }
 const HistogramData::HistogramE &EventList::e() const {
   if (!mru)
     throw std::runtime_error(
         "'EventList::e()' called with no MRU set. This is not allowed.");
 
-  return *sharedE();
+  auto eData = sharedE();
+  const auto &e = *eData;
+  // Keep the histogram alive while the caller holds the reference
+  mru->pinE(PARALLEL_THREAD_NUMBER, std::move(eData));
+  return e;
 }
 Kernel::cow_ptr<HistogramData::HistogramY> EventList::sharedY() const {
-  // This is the thread number from which this function was called.
-  int thread = PARALLEL_THREAD_NUMBER;
-
   Kernel::cow_ptr<HistogramData::HistogramY> yData(nullptr);
 
-  // Is the data in the mrulist?
-  if (mru) {
-    mru->ensureEnoughBuffersY(thread);
-    yData = mru->findY(thread, this);
-  }
+  // Is the data in the cache?
+  if (mru)
+    yData = mru->findY(this, m_version);
 
   if (!yData) {
     MantidVec Y;
@@ -1398,25 +1861,19 @@ Kernel::cow_ptr<HistogramData::HistogramY> EventList::sharedY() const {
 
     // Lets save it in the MRU
     if (mru) {
-      mru->insertY(thread, yData, this);
+      mru->insertY(yData, this, m_version);
       auto eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
-      mru->ensureEnoughBuffersE(thread);
-      mru->insertE(thread, eData, this);
+      mru->insertE(eData, this, m_version);
     }
   }
   return yData;
 }
 Kernel::cow_ptr<HistogramData::HistogramE> EventList::sharedE() const {
-  // This is the thread number from which this function was called.
-  int thread = PARALLEL_THREAD_NUMBER;
-
   Kernel::cow_ptr<HistogramData::HistogramE> eData(nullptr);
 
-  // Is the data in the mrulist?
-  if (mru) {
-    mru->ensureEnoughBuffersE(thread);
-    eData = mru->findE(thread, this);
-  }
+  // Is the data in the cache?
+  if (mru)
+    eData = mru->findE(this, m_version);
 
   if (!eData) {
     // Now use that to get E -- Y values are generated from another function
@@ -1427,7 +1884,7 @@ Kernel::cow_ptr<HistogramData::HistogramE> EventList::sharedE() const {
 
     // Lets save it in the MRU
     if (mru)
-      mru->insertE(thread, eData, this);
+      mru->insertE(eData, this, m_version);
   }
   return eData;
 }
@@ -1441,9 +1898,9 @@ const MantidVec &EventList::dataY() const {
     throw std::runtime_error(
         "'EventList::dataY()' called with no MRU set. This is not allowed.");
 
-  // WARNING: The Y data of sharedY() is stored in MRU, returning reference fine
-  // as long as it stays there.
-  return sharedY()->rawData();
+  // WARNING: The Y data is pinned in the MRU, returning reference fine as long
+  // as it stays there.
+  return y().rawData();
 }
 
 /** Look in the MRU to see if the E histogram has been generated before.
@@ -1456,9 +1913,9 @@ const MantidVec &EventList::dataE() const {
     throw std::runtime_error(
         "'EventList::dataE()' called with no MRU set. This is not allowed.");
 
-  // WARNING: The E data of sharedE() is stored in MRU, returning reference fine
-  // as long as it stays there.
-  return sharedE()->rawData();
+  // WARNING: The E data is pinned in the MRU, returning reference fine as long
+  // as it stays there.
+  return e().rawData();
 }
 
 namespace {
@@ -1491,6 +1948,29 @@ EventList::compressEventsHelper(const std::vector<T> &events,
   // We will make a starting guess of 1/20th of the number of input events.
   out.reserve(events.size() / 20);
 
+  compressEventRangeHelper(events.cbegin(), events.cend(), out, tolerance);
+
+  // If you have over-allocated by more than 5%, reduce the size.
+  size_t excess_limit = out.size() / 20;
+  if ((out.capacity() - out.size()) > excess_limit) {
+    out.shrink_to_fit();
+  }
+}
+
+// --------------------------------------------------------------------------
+/** Compress a range of events sorted by TOF, appending the compressed events
+ * to the output.
+ *
+ * @param first :: iterator to the first event.
+ * @param last :: iterator past the last event.
+ * @param out :: output WeightedEventNoTime vector.
+ * @param tolerance :: how close do two event's TOF have to be to be considered
+ *the same.
+ */
+template <class IT>
+void EventList::compressEventRangeHelper(IT first, IT last,
+                                         std::vector<WeightedEventNoTime> &out,
+                                         double tolerance) {
   // The last TOF to which we are comparing.
   double lastTof = std::numeric_limits<double>::lowest();
   // For getting an accurate average TOF
@@ -1501,7 +1981,7 @@ EventList::compressEventsHelper(const std::vector<T> &events,
   double errorSquared = 0;
   double normalization = 0.;
 
-  for (auto it = events.cbegin(); it != events.cend(); it++) {
+  for (auto it = first; it != last; it++) {
     if ((it->m_tof - lastTof) <= tolerance) {
       // Carry the error and weight
       weight += it->weight();
@@ -1540,18 +2020,17 @@ EventList::compressEventsHelper(const std::vector<T> &events,
   } else if (num > 1) {
     out.emplace_back(totalTof / normalization, weight, errorSquared);
   }
-
-  // If you have over-allocated by more than 5%, reduce the size.
-  size_t excess_limit = out.size() / 20;
-  if ((out.capacity() - out.size()) > excess_limit) {
-    out.shrink_to_fit();
-  }
 }
 
 // --------------------------------------------------------------------------
 /** Compress the event list by grouping events with the same TOF.
  * Performs the compression in parallel.
  *
+ * The sorted events are split into blocks that are compressed independently
+ * and then joined. A block only starts at an event more than tolerance away
+ * from the previous one: such an event starts a new compressed event in the
+ * serial algorithm too, so the result is the same as compressEventsHelper().
+ *
  * @param events :: input event list.
  * @param out :: output WeightedEventNoTime vector.
  * @param tolerance :: how close do two event's TOF have to be to be considered
@@ -1562,84 +2041,48 @@ template <class T>
 void EventList::compressEventsParallelHelper(
     const std::vector<T> &events, std::vector<WeightedEventNoTime> &out,
     double tolerance) {
-  // Create a local output vector for each thread
-  int numThreads = PARALLEL_GET_MAX_THREADS;
-  std::vector<std::vector<WeightedEventNoTime>> outputs(numThreads);
-  // This is how many events to process in each thread.
-  size_t numPerBlock = events.size() / numThreads;
-
-  // Do each block in parallel
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int thread = 0; thread < numThreads; thread++) {
-    // The local output vector
-    std::vector<WeightedEventNoTime> &localOut = outputs[thread];
-    // Reserve a bit of space to avoid excess copying
-    localOut.clear();
-    localOut.reserve(numPerBlock / 20);
-
-    // The last TOF to which we are comparing.
-    double lastTof = std::numeric_limits<double>::lowest();
-    // For getting an accurate average TOF
-    double totalTof = 0;
-    int num = 0;
-    // Carrying weight, error, and normalization
-    double weight = 0;
-    double errorSquared = 0;
-    double normalization = 0.;
-
-    // Separate the
-    typename std::vector<T>::const_iterator it =
-        events.begin() + thread * numPerBlock;
-    typename std::vector<T>::const_iterator it_end =
-        events.begin() + (thread + 1) * numPerBlock; // cache for speed
-    if (thread == numThreads - 1)
-      it_end = events.end();
-    for (; it != it_end; ++it) {
-      if ((it->m_tof - lastTof) <= tolerance) {
-        // Carry the error and weight
-        weight += it->weight();
-        errorSquared += it->errorSquared();
-        // Track the average tof
-        num++;
-        const double norm = calcNorm(it->errorSquared());
-        normalization += norm;
-        totalTof += it->m_tof * norm;
-      } else {
-        // We exceeded the tolerance
-        if (num > 0) {
-          // Create a new event with the average TOF and summed weights and
-          // squared errors.
-          localOut.emplace_back(totalTof / normalization, weight, errorSquared);
-        }
-        // Start a new combined object
-        num = 1;
-        const double norm = calcNorm(it->errorSquared());
-        normalization = norm;
-        totalTof = it->m_tof * norm;
-        weight = it->weight();
-        errorSquared = it->errorSquared();
-        lastTof = it->m_tof;
-      }
-    }
-
-    // Put the last event in there too.
-    if (num > 0) {
-      // Create a new event with the average TOF and summed weights and squared
-      // errors.
-      localOut.emplace_back(totalTof / normalization, weight, errorSquared);
-    }
+  // A few blocks per thread to balance the load
+  const auto numBlocks =
+      std::max<size_t>(1, 4 * static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
+  const size_t numPerBlock = events.size() / numBlocks;
+  std::vector<size_t> bounds{0};
+  for (size_t block = 1; block < numBlocks; ++block) {
+    size_t bound = std::max(block * numPerBlock, bounds.back() + 1);
+    while (bound < events.size() &&
+           events[bound].m_tof - events[bound - 1].m_tof <= tolerance)
+      ++bound;
+    if (bound >= events.size())
+      break;
+    bounds.emplace_back(bound);
   }
+  bounds.emplace_back(events.size());
+
+  // Compress each block into a local output vector
+  std::vector<std::vector<WeightedEventNoTime>> outputs(bounds.size() - 1);
+  tbb::parallel_for(
+      tbb::blocked_range<size_t>(0, outputs.size(), 1),
+      [&events, &bounds, &outputs,
+       tolerance](const tbb::blocked_range<size_t> &range) {
+        for (size_t block = range.begin(); block < range.end(); ++block) {
+          auto &localOut = outputs[block];
+          // Reserve a bit of space to avoid excess copying
+          localOut.reserve((bounds[block + 1] - bounds[block]) / 20);
+          compressEventRangeHelper(events.cbegin() + bounds[block],
+                                   events.cbegin() + bounds[block + 1],
+                                   localOut, tolerance);
+        }
+      });
 
   // Clear the output. Reserve the required size
   out.clear();
   size_t numEvents = 0;
-  for (int thread = 0; thread < numThreads; thread++)
-    numEvents += outputs[thread].size();
+  for (const auto &localOut : outputs)
+    numEvents += localOut.size();
   out.reserve(numEvents);
 
   // Re-join all the outputs
-  for (int thread = 0; thread < numThreads; thread++)
-    out.insert(out.end(), outputs[thread].begin(), outputs[thread].end());
+  for (const auto &localOut : outputs)
+    out.insert(out.end(), localOut.cbegin(), localOut.cend());
 }
 
 template <class T>
@@ -1761,25 +2204,33 @@ inline void EventList::compressFatEventsHelper(
  *be == this.
  */
 void EventList::compressEvents(double tolerance, EventList *destination) {
+  this->unpackColumns();
+  // The destination's events are replaced
+  destination->m_columns.reset();
+  ++destination->m_version;
   if (!this->empty()) {
     this->sortTof();
+    // Huge lists, e.g. monitors or summed banks, are compressed in parallel
+    const bool parallel = this->getNumberEvents() >= PARALLEL_COMPRESS_SIZE;
     switch (eventType) {
     case TOF:
-      //      if (parallel)
-      //        compressEventsParallelHelper(this->events,
-      //        destination->weightedEventsNoTime, tolerance);
-      //      else
-      compressEventsHelper(this->events, destination->weightedEventsNoTime,
-                           tolerance);
+      if (parallel)
+        compressEventsParallelHelper(this->events,
+                                     destination->weightedEventsNoTime,
+                                     tolerance);
+      else
+        compressEventsHelper(this->events, destination->weightedEventsNoTime,
+                             tolerance);
       break;
 
     case WEIGHTED:
-      //      if (parallel)
-      //        compressEventsParallelHelper(this->weightedEvents,
-      //        destination->weightedEventsNoTime, tolerance);
-      //      else
-      compressEventsHelper(this->weightedEvents,
-                           destination->weightedEventsNoTime, tolerance);
+      if (parallel)
+        compressEventsParallelHelper(this->weightedEvents,
+                                     destination->weightedEventsNoTime,
+                                     tolerance);
+      else
+        compressEventsHelper(this->weightedEvents,
+                             destination->weightedEventsNoTime, tolerance);
 
       break;
 
@@ -1787,21 +2238,21 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
       if (destination == this) {
         // Put results in a temp output
         std::vector<WeightedEventNoTime> out;
-        //        if (parallel)
-        //          compressEventsParallelHelper(this->weightedEventsNoTime,
-        //          out,
-        //          tolerance);
-        //        else
-        compressEventsHelper(this->weightedEventsNoTime, out, tolerance);
+        if (parallel)
+          compressEventsParallelHelper(this->weightedEventsNoTime, out,
+                                       tolerance);
+        else
+          compressEventsHelper(this->weightedEventsNoTime, out, tolerance);
         // Put it back
         this->weightedEventsNoTime.swap(out);
       } else {
-        //        if (parallel)
-        //          compressEventsParallelHelper(this->weightedEventsNoTime,
-        //          destination->weightedEventsNoTime, tolerance);
-        //        else
-        compressEventsHelper(this->weightedEventsNoTime,
-                             destination->weightedEventsNoTime, tolerance);
+        if (parallel)
+          compressEventsParallelHelper(this->weightedEventsNoTime,
+                                       destination->weightedEventsNoTime,
+                                       tolerance);
+        else
+          compressEventsHelper(this->weightedEventsNoTime,
+                               destination->weightedEventsNoTime, tolerance);
       }
       break;
     }
@@ -1817,6 +2268,10 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
 void EventList::compressFatEvents(
     const double tolerance, const Mantid::Types::Core::DateAndTime &timeStart,
     const double seconds, EventList *destination) {
+  this->unpackColumns();
+  // The destination's events are replaced
+  destination->m_columns.reset();
+  ++destination->m_version;
 
   // only worry about non-empty EventLists
   if (!this->empty()) {
@@ -2051,6 +2506,30 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events,
  */
 void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y,
                                            MantidVec &E, bool skipError) const {
+  if (m_selection) {
+    // Sort a copy of the selected events, not the shared parent
+    EventList selected(*this);
+    selected.unpackColumns();
+    selected.generateHistogramPulseTime(X, Y, E, skipError);
+    return;
+  }
+  this->unpackColumns();
+  if (eventType == TOF && this->order != PULSETIME_SORT) {
+    // Bin edges with a closed form do not need the events to be sorted
+    const EventBinner binner(X);
+    if (binner.isClosedForm()) {
+      Y.assign(X.size() - 1, 0.0);
+      binner.binEvents(
+          this->events,
+          [](const TofEvent &event) {
+            return static_cast<double>(event.pulseTime().totalNanoseconds());
+          },
+          [&Y](const size_t bin, const TofEvent &) { ++Y[bin]; });
+      if (!skipError)
+        this->generateErrorsHistogram(Y, E);
+      return;
+    }
+  }
   // All types of weights need to be sorted by Pulse Time
   this->sortPulseTime();
 
@@ -2088,6 +2567,15 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
                                               const double &tofFactor,
                                               const double &tofOffset,
                                               bool skipError) const {
+  if (m_selection) {
+    // Sort a copy of the selected events, not the shared parent
+    EventList selected(*this);
+    selected.unpackColumns();
+    selected.generateHistogramTimeAtSample(X, Y, E, tofFactor, tofOffset,
+                                           skipError);
+    return;
+  }
+  this->unpackColumns();
   // All types of weights need to be sorted by time at sample
   this->sortTimeAtSample(tofFactor, tofOffset);
 
@@ -2121,10 +2609,53 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E, bool skipError) const {
-  // All types of weights need to be sorted by TOF
+  const auto selection = m_selection;
+  if (selection) {
+    // The ranges of the shared parent are histogrammed in place
+    const EventList &parent = selection->parent();
+    parent.unpackColumns();
+    switch (eventType) {
+    case TOF:
+      histogramRanges(X, parent.events, selection->ranges(), Y, E);
+      break;
+    case WEIGHTED:
+      histogramRanges(X, parent.weightedEvents, selection->ranges(), Y, E);
+      break;
+    case WEIGHTED_NOTIME:
+      histogramRanges(X, parent.weightedEventsNoTime, selection->ranges(), Y,
+                      E);
+      break;
+    }
+    return;
+  }
+  if (!m_columns && !this->isSortedByTof() && !this->empty()) {
+    // Bin edges with a closed form do not need the events to be sorted
+    const EventBinner binner(X);
+    if (binner.isClosedForm()) {
+      switch (eventType) {
+      case TOF:
+        histogramUnsorted(binner, this->events, X, Y, E, skipError);
+        break;
+      case WEIGHTED:
+        histogramUnsorted(binner, this->weightedEvents, X, Y, E, skipError);
+        break;
+      case WEIGHTED_NOTIME:
+        histogramUnsorted(binner, this->weightedEventsNoTime, X, Y, E,
+                          skipError);
+        break;
+      }
+      return;
+    }
+  }
 
+  // All types of weights need to be sorted by TOF
   this->sortTof();
 
+  if (m_columns) {
+    m_columns->generateHistogram(X, Y, E, skipError);
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     // Make the single ones
@@ -2152,6 +2683,13 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateCountsHistogramPulseTime(const MantidVec &X,
                                                  MantidVec &Y) const {
+  if (m_selection) {
+    // Sort a copy of the selected events, not the shared parent
+    EventList selected(*this);
+    selected.unpackColumns();
+    selected.generateCountsHistogramPulseTime(X, Y);
+    return;
+  }
   // For slight speed=up.
   size_t x_size = X.size();
 
@@ -2162,6 +2700,7 @@ void EventList::generateCountsHistogramPulseTime(const MantidVec &X,
   }
 
   // Sort the events by pulsetime
+  this->unpackColumns();
   this->sortPulseTime();
   // Clear the Y data, assign all to 0.
   Y.resize(x_size - 1, 0);
@@ -2231,6 +2770,13 @@ void EventList::generateCountsHistogramPulseTime(const double &xMin,
                                                  MantidVec &Y,
                                                  const double TOF_min,
                                                  const double TOF_max) const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    eventsToRead(selected).generateCountsHistogramPulseTime(xMin, xMax, Y,
+                                                             TOF_min, TOF_max);
+    return;
+  }
+  this->unpackColumns();
 
   if (this->events.empty())
     return;
@@ -2266,6 +2812,13 @@ void EventList::generateCountsHistogramPulseTime(const double &xMin,
 void EventList::generateCountsHistogramTimeAtSample(
     const MantidVec &X, MantidVec &Y, const double &tofFactor,
     const double &tofOffset) const {
+  if (m_selection) {
+    // Sort a copy of the selected events, not the shared parent
+    EventList selected(*this);
+    selected.unpackColumns();
+    selected.generateCountsHistogramTimeAtSample(X, Y, tofFactor, tofOffset);
+    return;
+  }
   // For slight speed=up.
   const size_t x_size = X.size();
 
@@ -2484,6 +3037,17 @@ double EventList::integrate(const double minX, const double maxX,
 void EventList::integrate(const double minX, const double maxX,
                           const bool entireRange, double &sum,
                           double &error) const {
+  if (m_selection) {
+    // Sort a copy of the selected events, not the shared parent
+    std::unique_ptr<EventList> selected;
+    if (!entireRange)
+      selected = std::make_unique<EventList>(*this);
+    const EventList &source = entireRange ? eventsToRead(selected) : *selected;
+    source.unpackColumns();
+    source.integrate(minX, maxX, entireRange, sum, error);
+    return;
+  }
+  this->unpackColumns();
   sum = 0;
   error = 0;
   if (!entireRange) {
@@ -2521,6 +3085,7 @@ void EventList::integrate(const double minX, const double maxX,
  */
 void EventList::convertTof(std::function<double(double)> func,
                            const int sorting) {
+  copySelectedEvents();
   // fix the histogram parameter
   MantidVec &x = dataX();
   transform(x.begin(), x.end(), x.begin(), func);
@@ -2535,6 +3100,11 @@ void EventList::convertTof(std::function<double(double)> func,
   if (this->getNumberEvents() <= 0)
     return;
 
+  if (m_columns) {
+    m_columns->convertTof(func);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2568,6 +3138,7 @@ void EventList::convertTofHelper(std::vector<T> &events,
  * @param offset :: The value to shift the time-of-flight by
  */
 void EventList::convertTof(const double factor, const double offset) {
+  copySelectedEvents();
   // fix the histogram parameter
   auto &x = mutableX();
   x *= factor;
@@ -2579,6 +3150,11 @@ void EventList::convertTof(const double factor, const double offset) {
   if (this->getNumberEvents() <= 0)
     return;
 
+  if (m_columns) {
+    m_columns->convertTof(factor, offset);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2665,6 +3241,7 @@ void EventList::addPulsetimesHelper(std::vector<T> &events,
  * @param seconds :: The value to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetime(const double seconds) {
+  this->unpackColumns();
   if (this->getNumberEvents() <= 0)
     return;
 
@@ -2690,6 +3267,7 @@ void EventList::addPulsetime(const double seconds) {
  * @param seconds :: A set of values to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetimes(const std::vector<double> &seconds) {
+  this->unpackColumns();
   if (this->getNumberEvents() <= 0)
     return;
   if (this->getNumberEvents() != seconds.size()) {
@@ -2760,6 +3338,8 @@ std::size_t EventList::maskTofHelper(std::vector<T> &events,
  * @param tofMax :: upper bound of TOF to filter out
  */
 void EventList::maskTof(const double tofMin, const double tofMax) {
+  this->unpackColumns();
+  ++m_version;
   if (tofMax <= tofMin)
     throw std::runtime_error("EventList::maskTof: tofMax must be > tofMin");
 
@@ -2830,6 +3410,8 @@ std::size_t EventList::maskConditionHelper(std::vector<T> &events,
  * @param mask :: condition vector
  */
 void EventList::maskCondition(const std::vector<bool> &mask) {
+  this->unpackColumns();
+  ++m_version;
 
   // mask size must match the number of events
   if (this->getNumberEvents() != mask.size())
@@ -2879,6 +3461,16 @@ void EventList::getTofsHelper(const std::vector<T> &events,
  *  @param tofs :: A reference to the vector to be filled
  */
 void EventList::getTofs(std::vector<double> &tofs) const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    eventsToRead(selected).getTofs(tofs);
+    return;
+  }
+  copySelectedEvents();
+  if (m_columns) {
+    m_columns->getTofs(tofs);
+    return;
+  }
   // Set the capacity of the vector to avoid multiple resizes
   tofs.reserve(this->getNumberEvents());
 
@@ -2925,6 +3517,12 @@ void EventList::getWeightsHelper(const std::vector<T> &events,
  *  @param weights :: A reference to the vector to be filled
  */
 void EventList::getWeights(std::vector<double> &weights) const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    eventsToRead(selected).getWeights(weights);
+    return;
+  }
+  this->unpackColumns();
   // Set the capacity of the vector to avoid multiple resizes
   weights.reserve(this->getNumberEvents());
 
@@ -2973,6 +3571,12 @@ void EventList::getWeightErrorsHelper(const std::vector<T> &events,
  *  @param weightErrors :: A reference to the vector to be filled
  */
 void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    eventsToRead(selected).getWeightErrors(weightErrors);
+    return;
+  }
+  this->unpackColumns();
   // Set the capacity of the vector to avoid multiple resizes
   weightErrors.reserve(this->getNumberEvents());
 
@@ -3022,6 +3626,11 @@ void EventList::getPulseTimesHelper(
  * @return by copy a vector of DateAndTime times
  */
 std::vector<Mantid::Types::Core::DateAndTime> EventList::getPulseTimes() const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    return eventsToRead(selected).getPulseTimes();
+  }
+  this->unpackColumns();
   std::vector<Mantid::Types::Core::DateAndTime> times;
   // Set the capacity of the vector to avoid multiple resizes
   times.reserve(this->getNumberEvents());
@@ -3046,6 +3655,11 @@ std::vector<Mantid::Types::Core::DateAndTime> EventList::getPulseTimes() const {
  * @return The minimum tof value for the list of the events.
  */
 double EventList::getTofMin() const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    return eventsToRead(selected).getTofMin();
+  }
+  this->unpackColumns();
   // set up as the maximum available double
   double tMin = std::numeric_limits<double>::max();
 
@@ -3090,6 +3704,11 @@ double EventList::getTofMin() const {
  * @return The maximum tof value for the list of events.
  */
 double EventList::getTofMax() const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    return eventsToRead(selected).getTofMax();
+  }
+  this->unpackColumns();
   // set up as the minimum available double
   double tMax = std::numeric_limits<double>::lowest();
 
@@ -3135,6 +3754,11 @@ double EventList::getTofMax() const {
  * @return The minimum tof value for the list of the events.
  */
 DateAndTime EventList::getPulseTimeMin() const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    return eventsToRead(selected).getPulseTimeMin();
+  }
+  this->unpackColumns();
   // set up as the maximum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3179,6 +3803,11 @@ DateAndTime EventList::getPulseTimeMin() const {
  * @return The maximum tof value for the list of events.
  */
 DateAndTime EventList::getPulseTimeMax() const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    return eventsToRead(selected).getPulseTimeMax();
+  }
+  this->unpackColumns();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3222,6 +3851,12 @@ DateAndTime EventList::getPulseTimeMax() const {
 void EventList::getPulseTimeMinMax(
     Mantid::Types::Core::DateAndTime &tMin,
     Mantid::Types::Core::DateAndTime &tMax) const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    eventsToRead(selected).getPulseTimeMinMax(tMin, tMax);
+    return;
+  }
+  this->unpackColumns();
   // set up as the minimum available date time.
   tMax = DateAndTime::minimum();
   tMin = DateAndTime::maximum();
@@ -3272,6 +3907,11 @@ void EventList::getPulseTimeMinMax(
 
 DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
                                           const double &tofOffset) const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    return eventsToRead(selected).getTimeAtSampleMax(tofFactor, tofOffset);
+  }
+  this->unpackColumns();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3319,6 +3959,11 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
 
 DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor,
                                           const double &tofOffset) const {
+  if (m_selection) {
+    std::unique_ptr<EventList> selected;
+    return eventsToRead(selected).getTimeAtSampleMin(tofFactor, tofOffset);
+  }
+  this->unpackColumns();
   // set up as the minimum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3391,6 +4036,8 @@ void EventList::setTofsHelper(std::vector<T> &events,
  * @param tofs :: The vector of doubles to set the tofs to.
  */
 void EventList::setTofs(const MantidVec &tofs) {
+  this->unpackColumns();
+  ++m_version;
   this->order = UNSORTED;
 
   // Convert the list
@@ -3493,6 +4140,8 @@ EventList &EventList::operator*=(const double value) {
  * @param error: error on 'value'. Can be 0.
  */
 void EventList::multiply(const double value, const double error) {
+  this->unpackColumns();
+  ++m_version;
   // Do nothing if multiplying by exactly one and there is no error
   if ((value == 1.0) && (error == 0.0))
     return;
@@ -3621,6 +4270,8 @@ void EventList::multiplyHistogramHelper(std::vector<T> &events,
  */
 void EventList::multiply(const MantidVec &X, const MantidVec &Y,
                          const MantidVec &E) {
+  this->unpackColumns();
+  ++m_version;
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3761,6 +4412,8 @@ void EventList::divideHistogramHelper(std::vector<T> &events,
  */
 void EventList::divide(const MantidVec &X, const MantidVec &Y,
                        const MantidVec &E) {
+  this->unpackColumns();
+  ++m_version;
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3908,6 +4561,13 @@ void EventList::filterByPulseTime(DateAndTime start, DateAndTime stop,
   output.setHistogram(m_histogram);
   output.setSortOrder(this->order);
 
+  if (m_columns) {
+    // The output keeps the columnar storage
+    output.m_columns = std::make_unique<EventColumns>();
+    m_columns->filterByPulseTime(start, stop, *output.m_columns);
+    return;
+  }
+
   // Iterate through all events (sorted by pulse time)
   switch (eventType) {
   case TOF:
@@ -3928,6 +4588,7 @@ void EventList::filterByTimeAtSample(Types::Core::DateAndTime start,
                                      Types::Core::DateAndTime stop,
                                      double tofFactor, double tofOffset,
                                      EventList &output) const {
+  this->unpackColumns();
   if (this == &output) {
     throw std::invalid_argument("In-place filtering is not allowed");
   }
@@ -4043,6 +4704,8 @@ void EventList::filterInPlaceHelper(Kernel::TimeSplitterType &splitter,
  *     that will be kept. Any other events will be deleted.
  */
 void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
+  this->unpackColumns();
+  ++m_version;
   // Start by sorting the event list by pulse time.
   this->sortPulseTime();
 
@@ -4065,7 +4728,7 @@ void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
 /** Split the event list into n outputs, operating on a vector of either
  *TofEvent's or WeightedEvent's
  *  Only event's pulse time is used to compare with splitters.
- *  It is a faster and simple version of splitByFullTimeHelper
+ *  It is a faster and simple version of splitByFullTime
  *
  * @param splitter :: a TimeSplitterType giving where to split
  * @param outputs :: a vector of where the split events will end up. The # of
@@ -4134,6 +4797,7 @@ void EventList::splitByTimeHelper(Kernel::TimeSplitterType &splitter,
  */
 void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
                             std::vector<EventList *> outputs) const {
+  this->unpackColumns();
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
@@ -4167,321 +4831,381 @@ void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
   }
 }
 
-//------------------------------------------------------------------------------------------------
-/** Split the event list into n outputs, operating on a vector of either
- *TofEvent's or WeightedEvent's
- *  The comparison between neutron event and splitter is based on neutron
- *event's pulse time plus
- *
- * @param splitter :: a TimeSplitterType giving where to split
- * @param outputs :: a vector of where the split events will end up. The # of
- *entries in there should
- *        be big enough to accommodate the indices.
- * @param events :: either this->events or this->weightedEvents.
- * @param docorrection :: flag to determine whether or not to apply correction
- * @param toffactor :: factor to correct TOF in formula toffactor*tof+tofshift
- * @param tofshift :: amount to shift (in SECOND) to correct TOF in formula:
- *toffactor*tof+tofshift
+namespace {
+/// Marks the events that are not copied to any output
+constexpr uint32_t NO_OUTPUT = std::numeric_limits<uint32_t>::max();
+
+/** Convert a map of outputs, keyed by target group, to a vector indexed by
+ * target group + 1, so that the events excluded by the splitters (group -1)
+ * are the first entry.
  */
-template <class T>
-void EventList::splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
-                                      std::map<int, EventList *> outputs,
-                                      typename std::vector<T> &events,
-                                      bool docorrection, double toffactor,
-                                      double tofshift) const {
-  // 1. Prepare to Iterate through the splitter at the same time
-  auto itspl = splitter.begin();
-  auto itspl_end = splitter.end();
+std::vector<EventList *>
+outputsByGroup(const std::map<int, EventList *> &outputs) {
+  std::vector<EventList *> byGroup;
+  for (const auto &output : outputs) {
+    if (output.first < -1)
+      throw std::invalid_argument("Split target groups must be at least -1");
+    const auto slot = static_cast<size_t>(output.first + 1);
+    if (slot >= byGroup.size())
+      byGroup.resize(slot + 1, nullptr);
+    byGroup[slot] = output.second;
+  }
+  return byGroup;
+}
 
-  // 2. Prepare to Iterate through all events (sorted by tof)
-  auto itev = events.begin();
-  auto itev_end = events.end();
+/// Slot in the vector of outputs of a target group
+uint32_t outputSlot(const int group) {
+  return group >= -1 ? static_cast<uint32_t>(group + 1) : NO_OUTPUT;
+}
 
-  // 3. This is the time of the first section. Anything before is thrown out.
-  while (itspl != itspl_end) {
-    // Get the splitting interval times and destination
-    int64_t start = itspl->start().totalNanoseconds();
-    int64_t stop = itspl->stop().totalNanoseconds();
-    const int index = itspl->index();
+/// Pad the outputs with null entries so that every slot can be indexed
+std::vector<EventList *>
+paddedOutputs(const std::vector<EventList *> &outputs,
+              const std::vector<uint32_t> &intervalSlots) {
+  std::vector<EventList *> padded(outputs);
+  if (padded.empty())
+    padded.emplace_back(nullptr);
+  for (const auto slot : intervalSlots) {
+    if (slot != NO_OUTPUT && slot >= padded.size())
+      padded.resize(slot + 1, nullptr);
+  }
+  return padded;
+}
+
+/** Assign events to time intervals with a single cursor walk. Events before
+ * the start of the next interval go to the unfiltered slot, events after the
+ * last interval are dropped.
+ * @param events :: the events, sorted by pulse time
+ * @param eventTime :: functor returning the time of an event in nanoseconds
+ * @param starts :: start of each interval
+ * @param stops :: stop of each interval
+ * @param intervalSlots :: output slot of each interval
+ * @param unfilteredSlot :: output slot of events outside the intervals
+ * @param slots :: receives the output slot of each event
+ */
+template <class T, class TIME>
+void assignToIntervals(const std::vector<T> &events, TIME eventTime,
+                       const std::vector<int64_t> &starts,
+                       const std::vector<int64_t> &stops,
+                       const std::vector<uint32_t> &intervalSlots,
+                       const uint32_t unfilteredSlot,
+                       std::vector<uint32_t> &slots) {
+  slots.assign(events.size(), NO_OUTPUT);
+  size_t i = 0;
+  for (size_t interval = 0; interval < starts.size() && i < events.size();
+       ++interval) {
+    for (; i < events.size() && eventTime(events[i]) < starts[interval]; ++i)
+      slots[i] = unfilteredSlot;
+    for (; i < events.size() && eventTime(events[i]) < stops[interval]; ++i)
+      slots[i] = intervalSlots[interval];
+  }
+}
 
-    // a) Skip the events before the start of the time
-    // TODO This step can be
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      int64_t fulltime;
-      if (docorrection)
-        fulltime = calculateCorrectedFullTime(*itev, toffactor, tofshift);
-      else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < start) {
-        // a1) Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        itev++;
-      } else {
+/** Assign events to contiguous time intervals, the boundaries of which are
+ * given by a vector of times, with a single cursor walk. Events before the
+ * first interval and after the last one are dropped.
+ */
+template <class T, class TIME>
+void assignToSparseIntervals(const std::vector<T> &events, TIME eventTime,
+                             const std::vector<int64_t> &times,
+                             const std::vector<uint32_t> &intervalSlots,
+                             std::vector<uint32_t> &slots) {
+  slots.assign(events.size(), NO_OUTPUT);
+  size_t i = 0;
+  for (size_t interval = 0;
+       interval < intervalSlots.size() && i < events.size(); ++interval) {
+    for (; i < events.size(); ++i) {
+      const int64_t time = eventTime(events[i]);
+      if (time < times[interval])
+        continue; // Only happens before the first interval
+      if (time >= times[interval + 1])
         break;
-      }
+      slots[i] = intervalSlots[interval];
     }
+  }
+}
 
-    // b) Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-      int64_t fulltime;
-      if (docorrection)
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(toffactor * itev->m_tof * 1000 +
-                                        tofshift * 1.0E9);
-      else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < stop) {
-        // b1) Add a copy to the output
-        outputs[index]->addEventQuickly(*itev);
-        ++itev;
-      } else {
-        break;
-      }
-    }
+/** Assign each event to the interval (times[k-1], times[k]] that contains
+ * its time. Events outside all the intervals go to the unfiltered slot. The
+ * interval of the previous event is tried first, as the times of events
+ * sorted by pulse time are mostly increasing.
+ */
+template <class T, class TIME>
+void assignToIntervalsBySearch(const std::vector<T> &events, TIME eventTime,
+                               const std::vector<int64_t> &times,
+                               const std::vector<uint32_t> &intervalSlots,
+                               const uint32_t unfilteredSlot,
+                               std::vector<uint32_t> &slots) {
+  slots.resize(events.size());
+  size_t index = 0;
+  for (size_t i = 0; i < events.size(); ++i) {
+    const int64_t time = eventTime(events[i]);
+    // Same result as lower_bound(times, time)
+    if (!(index > 0 && index < times.size() && times[index - 1] < time &&
+          time <= times[index]))
+      index = std::lower_bound(times.cbegin(), times.cend(), time) -
+              times.cbegin();
+    if (index == 0 || index > times.size() - 1)
+      slots[i] = unfilteredSlot;
+    else
+      slots[i] = intervalSlots[index - 1];
+  }
+}
 
-    // Go to the next interval
-    ++itspl;
-    // But if we reached the end, then we are done.
-    if (itspl == itspl_end)
-      break;
+/** Copy the events to the outputs they were assigned to. The outputs are
+ * reserved first, so each is grown once.
+ * @param events :: the events, sorted by pulse time and TOF
+ * @param slots :: output slot of each event
+ * @param outputs :: the outputs, indexed by slot
+ * @return a message for each slot that received events but has no output;
+ * those events are dropped
+ */
+template <class T>
+std::string copyToOutputs(const std::vector<T> &events,
+                          const std::vector<uint32_t> &slots,
+                          const std::vector<EventList *> &outputs) {
+  std::vector<size_t> counts(outputs.size(), 0);
+  std::stringstream msgss;
+  for (const auto slot : slots) {
+    if (slot != NO_OUTPUT)
+      ++counts[slot];
+  }
 
-    // No need to keep looping through the filter if we are out of events
-    if (itev == itev_end)
-      break;
-  } // END-WHILE Splitter
+  std::vector<std::vector<T> *> vectors(outputs.size(), nullptr);
+  for (size_t slot = 0; slot < outputs.size(); ++slot) {
+    if (counts[slot] == 0)
+      continue;
+    if (!outputs[slot]) {
+      msgss << "Group " << static_cast<int>(slot) - 1
+            << " has a NULL output EventList. \n";
+      continue;
+    }
+    getEventsFrom(*outputs[slot], vectors[slot]);
+    vectors[slot]->reserve(vectors[slot]->size() + counts[slot]);
+    // A subset of sorted events is still sorted
+    outputs[slot]->setSortOrder(PULSETIMETOF_SORT);
+  }
+
+  for (size_t i = 0; i < events.size(); ++i) {
+    const auto slot = slots[i];
+    if (slot != NO_OUTPUT && vectors[slot])
+      vectors[slot]->emplace_back(events[i]);
+  }
+  return msgss.str();
 }
+} // namespace
 
 //------------------------------------------------------------------------------------------------
-/** Split the event list into n outputs by event's full time (tof + pulse time)
- *
- * @param splitter :: a TimeSplitterType giving where to split
- * @param outputs :: a map of where the split events will end up. The # of
- *entries in there should
- *        be big enough to accommodate the indices.
- * @param docorrection :: a boolean to indiciate whether it is need to do
- *correction
- * @param toffactor:  a correction factor for each TOF to multiply with
- * @param tofshift:  a correction shift for each TOF to add with
+/** Prepare the outputs of a split: they are cleared and given this list's
+ * detector IDs, histogram and event type.
+ * @param outputs :: the outputs, some of which may be null
  */
-void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
-                                std::map<int, EventList *> outputs,
-                                bool docorrection, double toffactor,
-                                double tofshift) const {
-  if (eventType == WEIGHTED_NOTIME)
-    throw std::runtime_error("EventList::splitByTime() called on an EventList "
-                             "that no longer has time information.");
-
-  // 1. Start by sorting the event list by pulse time.
-  this->sortPulseTimeTOF();
-
-  // 2. Initialize all the outputs
-  std::map<int, EventList *>::iterator outiter;
-  for (outiter = outputs.begin(); outiter != outputs.end(); ++outiter) {
-    EventList *opeventlist = outiter->second;
+void EventList::initializeSplitOutputs(
+    const std::vector<EventList *> &outputs) const {
+  for (auto *opeventlist : outputs) {
+    if (!opeventlist)
+      continue;
     opeventlist->clear();
     opeventlist->setDetectorIDs(this->getDetectorIDs());
     opeventlist->setHistogram(m_histogram);
     // Match the output event type.
     opeventlist->switchTo(eventType);
   }
+}
 
-  // Do nothing if there are no entries
-  if (splitter.empty()) {
-    // 3A. Copy all events to group workspace = -1
-    (*outputs[-1]) = (*this);
-    // this->duplicate(outputs[-1]);
-  } else {
-    // 3B. Split
+//------------------------------------------------------------------------------------------------
+/** Give the events of this list to the outputs they were assigned to.
+ * @param slots :: output slot of each event, NO_OUTPUT if it is dropped
+ * @param outputs :: the outputs, indexed by slot
+ * @param lazy :: if true, the outputs select the events of this list, which
+ * are shared rather than copied (see shareEvents()), otherwise the events are
+ * copied into them
+ * @return a message for each slot that received events but has no output;
+ * those events are dropped
+ */
+std::string
+EventList::distributeToOutputs(const std::vector<uint32_t> &slots,
+                               const std::vector<EventList *> &outputs,
+                               const bool lazy) const {
+  if (!lazy) {
     switch (eventType) {
     case TOF:
-      splitByFullTimeHelper(splitter, outputs, this->events, docorrection,
-                            toffactor, tofshift);
-      break;
+      return copyToOutputs(this->events, slots, outputs);
     case WEIGHTED:
-      splitByFullTimeHelper(splitter, outputs, this->weightedEvents,
-                            docorrection, toffactor, tofshift);
-      break;
+      return copyToOutputs(this->weightedEvents, slots, outputs);
     case WEIGHTED_NOTIME:
-      break;
+      return copyToOutputs(this->weightedEventsNoTime, slots, outputs);
     }
   }
-}
 
-//------------------------------------------------------------------------------------------------
-/** Split the event list into n outputs, operating on a vector of either
- *TofEvent's or WeightedEvent's
- *  The comparison between neutron event and splitter is based on neutron
- *event's pulse time plus
- *
- * @param vectimes :: a vector of absolute time in nanoseconds serving as
- *boundaries of splitters
- * @param vecgroups :: a vector of integer serving as the target workspace group
- *for splitters
- * @param outputs :: a vector of where the split events will end up. The # of
- *entries in there should
- *        be big enough to accommodate the indices.
- * @param vecEvents :: either this->events or this->weightedEvents.
- * @param docorrection :: flag to determine whether or not to apply correction
- * @param toffactor :: factor multiplied to TOF for correcting event time from
- *detector to sample
- * @param tofshift :: shift in SECOND to TOF for correcting event time from
- *detector to sample
- */
-template <class T>
-std::string EventList::splitByFullTimeVectorSplitterHelper(
-    const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-    std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-    bool docorrection, double toffactor, double tofshift) const {
-  // Define variables for events
-  // size_t numevents = events.size();
-  typename std::vector<T>::iterator eviter;
-  std::stringstream msgss;
-
-  // Loop through events
-  for (eviter = vecEvents.begin(); eviter != vecEvents.end(); ++eviter) {
-    // Obtain time of event
-    int64_t evabstimens;
-    if (docorrection)
-      evabstimens = eviter->m_pulsetime.totalNanoseconds() +
-                    static_cast<int64_t>(toffactor * eviter->m_tof * 1000 +
-                                         tofshift * 1.0E9);
-    else
-      evabstimens = eviter->m_pulsetime.totalNanoseconds() +
-                    static_cast<int64_t>(eviter->m_tof * 1000);
-
-    // Search in vector
-    int index = static_cast<int>(
-        lower_bound(vectimes.begin(), vectimes.end(), evabstimens) -
-        vectimes.begin());
-    int group;
-    // FIXME - whether lower_bound() equal to vectimes.size()-1 should be
-    // filtered out?
-    if (index == 0 || index > static_cast<int>(vectimes.size() - 1)) {
-      // Event is before first splitter or after last splitter.  Put to -1
-      group = -1;
-    } else {
-      group = vecgroups[index - 1];
-    }
+  // Ranges of consecutive events going to the same output
+  std::vector<std::vector<EventSelection::Range>> ranges(outputs.size());
+  for (size_t begin = 0; begin < slots.size();) {
+    size_t end = begin + 1;
+    while (end < slots.size() && slots[end] == slots[begin])
+      ++end;
+    if (slots[begin] != NO_OUTPUT)
+      ranges[slots[begin]].emplace_back(begin, end);
+    begin = end;
+  }
 
-    // Copy event to the proper group
-    EventList *myOutput = outputs[group];
-    if (!myOutput) {
-      std::stringstream errss;
-      errss << "Group " << group << " has a NULL output EventList. "
-            << "\n";
-      msgss << errss.str();
-    } else {
-      const T eventCopy(*eviter);
-      myOutput->addEventQuickly(eventCopy);
+  std::stringstream msgss;
+  std::shared_ptr<const EventList> parent;
+  for (size_t slot = 0; slot < outputs.size(); ++slot) {
+    if (ranges[slot].empty())
+      continue;
+    if (!outputs[slot]) {
+      msgss << "Group " << static_cast<int>(slot) - 1
+            << " has a NULL output EventList. \n";
+      continue;
     }
+    if (!parent)
+      parent = shareEvents();
+    outputs[slot]->selectFrom(parent, std::move(ranges[slot]));
   }
+  return msgss.str();
+}
 
-  return (msgss.str());
+//------------------------------------------------------------------------------------------------
+/** Move the events of this list into a new list that is shared, without
+ * copying them, and make this list a selection of all of its events. The
+ * events of this list are unchanged, so cached histograms stay valid; they
+ * are copied back when this list is modified while still shared.
+ * Like sorting, this is done under the lock of the list, so it may be called
+ * from several threads.
+ * @return the list now holding the events, which must not be modified
+ */
+std::shared_ptr<const EventList> EventList::shareEvents() const {
+  this->unpackColumns();
+  // Avoid sharing from multiple threads
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  // If the events were shared while waiting for the lock, share them again.
+  if (m_selection && m_selection->isComplete())
+    return m_selection->sharedParent();
+  auto parent = std::make_shared<EventList>();
+  parent->eventType = eventType;
+  parent->order = order;
+  parent->events.swap(this->events);
+  parent->weightedEvents.swap(this->weightedEvents);
+  parent->weightedEventsNoTime.swap(this->weightedEventsNoTime);
+  const size_t numEvents = parent->getNumberEvents();
+  m_selection = std::make_shared<const EventSelection>(
+      parent, std::vector<EventSelection::Range>{{0, numEvents}});
+  return parent;
 }
 
 //------------------------------------------------------------------------------------------------
-/** Split the event list into n outputs, operating on a vector of either
- *TofEvent's or WeightedEvent's
- *  The comparison between neutron event and splitter is based on neutron
- *event's pulse time plus
+/** Split the event list into n outputs by event's full time (tof + pulse time)
  *
- * @param vectimes :: a vector of absolute time in nanoseconds serving as
- *boundaries of splitters
- * @param vecgroups :: a vector of integer serving as the target workspace group
- *for splitters
- * @param outputs :: a vector of where the split events will end up. The # of
+ * @param splitter :: a TimeSplitterType giving where to split
+ * @param outputs :: a map of where the split events will end up. The # of
  *entries in there should
  *        be big enough to accommodate the indices.
- * @param vecEvents :: either this->events or this->weightedEvents.
- * @param docorrection :: flag to determine whether or not to apply correction
- * @param toffactor :: factor multiplied to TOF for correcting event time from
- *detector to sample
- * @param tofshift :: shift in SECOND to TOF for correcting event time from
- *detector to sample
+ * @param docorrection :: a boolean to indiciate whether it is need to do
+ *correction
+ * @param toffactor:  a correction factor for each TOF to multiply with
+ * @param tofshift:  a correction shift for each TOF to add with
  */
-template <class T>
-std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
-    const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-    std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-    bool docorrection, double toffactor, double tofshift) const {
-  // Define variables for events
-  // size_t numevents = events.size();
-  // typename std::vector<T>::iterator eviter;
-  std::stringstream msgss;
+void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
+                                std::map<int, EventList *> outputs,
+                                bool docorrection, double toffactor,
+                                double tofshift) const {
+  splitByFullTime(splitter, outputsByGroup(outputs), docorrection, toffactor,
+                  tofshift);
+}
 
-  size_t num_splitters = vecgroups.size();
-  // prepare to Iterate through all events (sorted by tof)
-  auto iter_events = vecEvents.begin();
-  auto iter_events_end = vecEvents.end();
-
-  // std::stringstream debug_ss;
-  // debug_ss << "\nFilter events...:\n";
-
-  for (size_t i = 0; i < num_splitters; ++i) {
-    // get one splitter
-    int64_t start_i64 = vectimes[i];
-    int64_t stop_i64 = vectimes[i + 1];
-    int group = vecgroups[i];
-    // debug_ss << "working on splitter: " << i << " from " << start_i64 << " to
-    // " << stop_i64 << "\n";
-
-    // go over events
-    while (iter_events != iter_events_end) {
-      int64_t absolute_time;
-      if (docorrection)
-        absolute_time =
-            iter_events->m_pulsetime.totalNanoseconds() +
-            static_cast<int64_t>(toffactor * iter_events->m_tof * 1000 +
-                                 tofshift * 1.0E9);
-      else
-        absolute_time = iter_events->m_pulsetime.totalNanoseconds() +
-                        static_cast<int64_t>(iter_events->m_tof * 1000);
+//------------------------------------------------------------------------------------------------
+/** Split the event list into n outputs by event's full time (tof + pulse time)
+ * in a single pass over the events.
+ *
+ * @param splitter :: a TimeSplitterType giving where to split
+ * @param outputs :: where the split events will end up, indexed by target
+ *group + 1: the first entry receives the events outside the splitters.
+ * @param docorrection :: a boolean to indiciate whether it is need to do
+ *correction
+ * @param toffactor:  a correction factor for each TOF to multiply with
+ * @param tofshift:  a correction shift for each TOF to add with
+ * @param lazy :: if true, the outputs select the events of this list, shared
+ * rather than copied, instead of holding copies of them, see selectFrom()
+ */
+void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
+                                const std::vector<EventList *> &outputs,
+                                bool docorrection, double toffactor,
+                                double tofshift, const bool lazy) const {
+  if (!docorrection) {
+    toffactor = 1.0;
+    tofshift = 0.0;
+  }
+  splitByIntervals(
+      splitter, outputs,
+      [toffactor, tofshift](const auto &event) {
+        return calculateCorrectedFullTime(event, toffactor, tofshift);
+      },
+      lazy);
+}
 
-      // debug_ss << "  event " << iter_events - vecEvents.begin() << " abs.time
-      // = " << absolute_time << "\n";
+//------------------------------------------------------------------------------------------------
+/** Split the event list into n outputs by the time of the events given by a
+ * functor, walking the events and the splitters together once.
+ *
+ * @param splitter :: a TimeSplitterType giving where to split
+ * @param outputs :: where the split events will end up, indexed by target
+ *group + 1
+ * @param eventTime :: functor returning the time of an event in nanoseconds
+ * @param lazy :: if true, the outputs select the events of this list, shared
+ * rather than copied, instead of holding copies of them, see selectFrom()
+ */
+template <class TIME>
+void EventList::splitByIntervals(Kernel::TimeSplitterType &splitter,
+                                 const std::vector<EventList *> &outputs,
+                                 TIME eventTime, const bool lazy) const {
+  this->unpackColumns();
+  if (eventType == WEIGHTED_NOTIME)
+    throw std::runtime_error("EventList::splitByTime() called on an EventList "
+                             "that no longer has time information.");
 
-      if (absolute_time < start_i64) {
-        // event occurs before the splitter. only can happen with first
-        // splitter. Then ignore and move to next
-        ++iter_events;
-        continue;
-      }
+  // 1. Start by sorting the event list by pulse time.
+  this->sortPulseTimeTOF();
 
-      if (absolute_time < stop_i64) {
-        // in the splitter, then copy the event into another
-        const T eventCopy(*iter_events);
-        // Copy event to the proper group
-        EventList *myOutput = outputs[group];
-        if (!myOutput) {
-          // there is no such group defined. quit for this group
-          std::stringstream errss;
-          errss << "Group " << group << " has a NULL output EventList. "
-                << "\n";
-          msgss << errss.str();
-          throw std::runtime_error(errss.str());
-        }
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-        ++iter_events;
-      } else {
-        // event occurs after the stop time, it should belonged to the next
-        // splitter
-        break;
-      }
-    } // while
+  // 2. Initialize all the outputs
+  initializeSplitOutputs(outputs);
 
-    // quit the loop if there is no more event left
-    if (iter_events == iter_events_end)
-      break;
-  } // for splitter
+  // Do nothing if there are no entries
+  if (splitter.empty()) {
+    // 3A. Copy all events to group workspace = -1
+    (*outputs.at(0)) = (*this);
+    return;
+  }
 
-  // std::cout << debug_ss.str();
+  // 3B. Split
+  std::vector<int64_t> starts, stops;
+  std::vector<uint32_t> intervalSlots;
+  starts.reserve(splitter.size());
+  stops.reserve(splitter.size());
+  intervalSlots.reserve(splitter.size());
+  for (const auto &interval : splitter) {
+    starts.emplace_back(interval.start().totalNanoseconds());
+    stops.emplace_back(interval.stop().totalNanoseconds());
+    intervalSlots.emplace_back(outputSlot(interval.index()));
+  }
+  const auto slotOutputs = paddedOutputs(outputs, intervalSlots);
 
-  return (msgss.str());
+  std::vector<uint32_t> slots;
+  switch (eventType) {
+  case TOF:
+    assignToIntervals(this->events, eventTime, starts, stops, intervalSlots,
+                      outputSlot(-1), slots);
+    break;
+  case WEIGHTED:
+    assignToIntervals(this->weightedEvents, eventTime, starts, stops,
+                      intervalSlots, outputSlot(-1), slots);
+    break;
+  case WEIGHTED_NOTIME:
+    break;
+  }
+  const auto message = distributeToOutputs(slots, slotOutputs, lazy);
+  if (!message.empty())
+    throw std::runtime_error(message);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -4495,13 +5219,36 @@ std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
  * @param tofshift :: shift to TOF in unit of SECOND for correction
  * @return
  */
-// TODO/FIXME/NOW - Consider to use vector to replace vec_outputEventList and
-// have an option to ignore the un-filtered events!
 std::string EventList::splitByFullTimeMatrixSplitter(
     const std::vector<int64_t> &vec_splitters_time,
     const std::vector<int> &vecgroups,
     std::map<int, EventList *> vec_outputEventList, bool docorrection,
     double toffactor, double tofshift) const {
+  return splitByFullTimeMatrixSplitter(vec_splitters_time, vecgroups,
+                                       outputsByGroup(vec_outputEventList),
+                                       docorrection, toffactor, tofshift);
+}
+
+//----------------------------------------------------------------------------------------------
+/** Split the event list by full time with splitters given as a vector of
+ * times and a vector of target groups, in a single pass over the events.
+ * @param vec_splitters_time  :: vector of splitting times
+ * @param vecgroups :: vector of index group for splitters
+ * @param outputs :: where the split events will end up, indexed by target
+ * group + 1: the first entry receives the events outside the splitters.
+ * @param docorrection :: flag to do TOF correction from detector to sample
+ * @param toffactor :: factor multiplied to TOF for correction
+ * @param tofshift :: shift to TOF in unit of SECOND for correction
+ * @param lazy :: if true, the outputs select the events of this list, shared
+ * rather than copied, instead of holding copies of them, see selectFrom()
+ * @return messages about the events that could not be split
+ */
+std::string EventList::splitByFullTimeMatrixSplitter(
+    const std::vector<int64_t> &vec_splitters_time,
+    const std::vector<int> &vecgroups, const std::vector<EventList *> &outputs,
+    bool docorrection, double toffactor, double tofshift,
+    const bool lazy) const {
+  this->unpackColumns();
   // Check validity
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4512,165 +5259,90 @@ std::string EventList::splitByFullTimeMatrixSplitter(
   sortPulseTimeTOF();
 
   // Initialize all the output event list
-  std::map<int, EventList *>::iterator outiter;
-  for (outiter = vec_outputEventList.begin();
-       outiter != vec_outputEventList.end(); ++outiter) {
-    EventList *opeventlist = outiter->second;
-    opeventlist->clear();
-    opeventlist->setDetectorIDs(this->getDetectorIDs());
-    opeventlist->setHistogram(m_histogram);
-    // Match the output event type.
-    opeventlist->switchTo(eventType);
-  }
-
-  std::string debugmessage;
+  initializeSplitOutputs(outputs);
 
   // Do nothing if there are no entries
   if (vecgroups.empty()) {
     // Copy all events to group workspace = -1
-    (*vec_outputEventList[-1]) = (*this);
-    // this->duplicate(outputs[-1]);
-  } else {
-    // Split
-
-    // Try to find out which filtering algorithm to use by comparing number of
-    // splitters and number of events
-    bool sparse_splitter = vec_splitters_time.size() < this->getNumberEvents();
+    (*outputs.at(0)) = (*this);
+    return "";
+  }
 
-    switch (eventType) {
-    case TOF:
-      if (sparse_splitter)
-        debugmessage = splitByFullTimeSparseVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList, this->events,
-            docorrection, toffactor, tofshift);
-      else
-        debugmessage = splitByFullTimeVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList, this->events,
-            docorrection, toffactor, tofshift);
-      break;
-    case WEIGHTED:
-      if (sparse_splitter)
-        debugmessage = splitByFullTimeSparseVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList,
-            this->weightedEvents, docorrection, toffactor, tofshift);
-      else
-        debugmessage = splitByFullTimeVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList,
-            this->weightedEvents, docorrection, toffactor, tofshift);
-      break;
-    case WEIGHTED_NOTIME:
-      debugmessage = "TOF type is weighted no time.  Impossible to split. ";
-      break;
-    }
+  if (!docorrection) {
+    toffactor = 1.0;
+    tofshift = 0.0;
+  }
+  const auto eventTime = [toffactor, tofshift](const auto &event) {
+    return calculateCorrectedFullTime(event, toffactor, tofshift);
+  };
+
+  // Events in groups without an output are reported, not copied
+  std::vector<uint32_t> intervalSlots;
+  intervalSlots.reserve(vecgroups.size());
+  for (const auto group : vecgroups)
+    intervalSlots.emplace_back(outputSlot(group));
+  const auto slotOutputs = paddedOutputs(outputs, intervalSlots);
+
+  // Walk the splitters with the events when there are fewer splitters than
+  // events, search the splitters for each event otherwise
+  const bool sparse_splitter =
+      vec_splitters_time.size() < this->getNumberEvents();
+  std::vector<uint32_t> slots;
+  std::string debugmessage;
+  switch (eventType) {
+  case TOF:
+    if (sparse_splitter)
+      assignToSparseIntervals(this->events, eventTime, vec_splitters_time,
+                              intervalSlots, slots);
+    else
+      assignToIntervalsBySearch(this->events, eventTime, vec_splitters_time,
+                                intervalSlots, outputSlot(-1), slots);
+    debugmessage = distributeToOutputs(slots, slotOutputs, lazy);
+    break;
+  case WEIGHTED:
+    if (sparse_splitter)
+      assignToSparseIntervals(this->weightedEvents, eventTime,
+                              vec_splitters_time, intervalSlots, slots);
+    else
+      assignToIntervalsBySearch(this->weightedEvents, eventTime,
+                                vec_splitters_time, intervalSlots,
+                                outputSlot(-1), slots);
+    debugmessage = distributeToOutputs(slots, slotOutputs, lazy);
+    break;
+  case WEIGHTED_NOTIME:
+    debugmessage = "TOF type is weighted no time.  Impossible to split. ";
+    break;
   }
 
+  // The walk over sparse splitters does not tolerate missing outputs
+  if (sparse_splitter && !debugmessage.empty())
+    throw std::runtime_error(debugmessage);
   return debugmessage;
 }
 
-//-------------------------------------------
-//--------------------------------------------------
-/** Split the event list into n outputs by each event's pulse time only
- */
-template <class T>
-void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
-                                       std::map<int, EventList *> outputs,
-                                       typename std::vector<T> &events) const {
-  // Prepare to TimeSplitter Iterate through the splitter at the same time
-  auto itspl = splitter.begin();
-  auto itspl_end = splitter.end();
-  Types::Core::DateAndTime start, stop;
-
-  // Prepare to Events Iterate through all events (sorted by tof)
-  auto itev = events.begin();
-  auto itev_end = events.end();
-
-  // Iterate (loop) on all splitters
-  while (itspl != itspl_end) {
-    // Get the splitting interval times and destination group
-    start = itspl->start().totalNanoseconds();
-    stop = itspl->stop().totalNanoseconds();
-    const int index = itspl->index();
-
-    // Skip the events before the start of the time and put to 'unfiltered'
-    // EventList
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      if (itev->m_pulsetime < start) {
-        // Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Event within a splitter interval
-        break;
-      }
-    }
-
-    // Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-
-      if (itev->m_pulsetime < stop) {
-        outputs[index]->addEventQuickly(*itev);
-        ++itev;
-      } else {
-        // Out of interval
-        break;
-      }
-    }
-
-    // Go to the next interval
-    ++itspl;
-    // But if we reached the end, then we are done.
-    if (itspl == itspl_end)
-      break;
-
-    // No need to keep looping through the filter if we are out of events
-    if (itev == itev_end)
-      break;
-  } // END-WHILE Splitter
-}
-
 //----------------------------------------------------------------------------------------------
 /** Split the event list by pulse time
  */
 void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
                                  std::map<int, EventList *> outputs) const {
-  // Check for supported event type
-  if (eventType == WEIGHTED_NOTIME)
-    throw std::runtime_error("EventList::splitByTime() called on an EventList "
-                             "that no longer has time information.");
-
-  // Start by sorting the event list by pulse time.
-  this->sortPulseTimeTOF();
-
-  // Initialize all the output event lists
-  std::map<int, EventList *>::iterator outiter;
-  for (outiter = outputs.begin(); outiter != outputs.end(); ++outiter) {
-    EventList *opeventlist = outiter->second;
-    opeventlist->clear();
-    opeventlist->setDetectorIDs(this->getDetectorIDs());
-    opeventlist->setHistogram(m_histogram);
-    // Match the output event type.
-    opeventlist->switchTo(eventType);
-  }
+  splitByPulseTime(splitter, outputsByGroup(outputs));
+}
 
-  // Split
-  if (splitter.empty()) {
-    // No splitter: copy all events to group workspace = -1
-    (*outputs[-1]) = (*this);
-  } else {
-    // Split
-    switch (eventType) {
-    case TOF:
-      splitByPulseTimeHelper(splitter, outputs, this->events);
-      break;
-    case WEIGHTED:
-      splitByPulseTimeHelper(splitter, outputs, this->weightedEvents);
-      break;
-    case WEIGHTED_NOTIME:
-      break;
-    }
-  }
+//----------------------------------------------------------------------------------------------
+/** Split the event list by pulse time in a single pass over the events
+ * @param splitter :: a TimeSplitterType giving where to split
+ * @param outputs :: where the split events will end up, indexed by target
+ * group + 1: the first entry receives the events outside the splitters.
+ * @param lazy :: if true, the outputs select the events of this list, shared
+ * rather than copied, instead of holding copies of them, see selectFrom()
+ */
+void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
+                                 const std::vector<EventList *> &outputs,
+                                 const bool lazy) const {
+  splitByIntervals(
+      splitter, outputs,
+      [](const auto &event) { return event.pulseTime().totalNanoseconds(); },
+      lazy);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -4680,6 +5352,7 @@ void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
 void EventList::splitByPulseTimeWithMatrix(
     const std::vector<int64_t> &vec_times, const std::vector<int> &vec_target,
     std::map<int, EventList *> outputs) const {
+  this->unpackColumns();
   // Check for supported event type
   if (eventType == WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
@@ -4859,6 +5532,8 @@ void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
  */
 void EventList::convertUnitsViaTof(Mantid::Kernel::Unit *fromUnit,
                                    Mantid::Kernel::Unit *toUnit) {
+  this->unpackColumns();
+  ++m_version;
   // Check for initialized
   if (!fromUnit || !toUnit)
     throw std::runtime_error(
@@ -4907,6 +5582,8 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events,
  *  @param power :: the Power b to apply to the conversion
  */
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
+  this->unpackColumns();
+  ++m_version;
   switch (eventType) {
   case TOF:
     convertUnitsQuicklyHelper(this->events, factor, power);
@@ -4923,6 +5600,7 @@ void EventList::convertUnitsQuickly(const double &factor, const double &power) {
 HistogramData::Histogram &EventList::mutableHistogramRef() {
   if (mru)
     mru->deleteIndex(this);
+  ++m_version;
   return m_histogram;
 }
 
@@ -0,0 +1,44 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventSelection.h"
+#include "MantidDataObjects/EventList.h"
+
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** Constructor
+ * @param parent :: the list whose events are selected
+ * @param ranges :: the ranges of indices of the selected events. They must be
+ * sorted and disjoint, so that the selected events keep the order of the
+ * parent.
+ * @throw std::invalid_argument if there is no parent or the ranges are invalid
+ */
+EventSelection::EventSelection(std::shared_ptr<const EventList> parent,
+                               std::vector<Range> ranges)
+    : m_parent(std::move(parent)), m_ranges(std::move(ranges)), m_size(0) {
+  if (!m_parent)
+    throw std::invalid_argument("EventSelection needs a parent EventList");
+  const auto numEvents = m_parent->getNumberEvents();
+  std::size_t previousEnd = 0;
+  for (const auto &range : m_ranges) {
+    if (range.first < previousEnd || range.first > range.second ||
+        range.second > numEvents)
+      throw std::invalid_argument("EventSelection ranges must be sorted, "
+                                  "disjoint and inside the parent EventList");
+    previousEnd = range.second;
+    m_size += range.second - range.first;
+  }
+}
+
+bool EventSelection::isComplete() const {
+  return m_size == m_parent->getNumberEvents();
+}
+
+} // namespace DataObjects
+} // namespace Mantid
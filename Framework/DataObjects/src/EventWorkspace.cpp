@@ -50,17 +50,36 @@ EventWorkspace::EventWorkspace(const Parallel::StorageMode storageMode)
 
 EventWorkspace::EventWorkspace(const EventWorkspace &other)
     : IEventWorkspace(other), mru(std::make_unique<EventWorkspaceMRU>()) {
-  for (const auto &el : other.data) {
-    // Create a new event list, copying over the events
-    auto newel = std::make_unique<EventList>(*el);
-    // Make sure to update the MRU to point to THIS event workspace.
-    newel->setMRU(this->mru.get());
-    this->data.emplace_back(std::move(newel));
-  }
+  // With millions of spectra the allocations dominate, so the event lists are
+  // copied in parallel
+  data.resize(other.data.size());
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()),
+                    [this, &other](const tbb::blocked_range<size_t> &range) {
+                      for (size_t i = range.begin(); i < range.end(); ++i) {
+                        // Create a new event list, copying over the events
+                        data[i] = std::make_unique<EventList>(*other.data[i]);
+                        // Make sure to update the MRU to point to THIS event
+                        // workspace.
+                        data[i]->setMRU(this->mru.get());
+                      }
+                    });
+}
+
+EventWorkspace::~EventWorkspace() {
+  // The MRU goes away with the workspace, so the event lists do not need to
+  // remove themselves from it one by one. Free them in parallel.
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()),
+                    [this](const tbb::blocked_range<size_t> &range) {
+                      for (size_t i = range.begin(); i < range.end(); ++i) {
+                        if (!data[i])
+                          continue;
+                        data[i]->setMRU(nullptr);
+                        data[i].reset();
+                      }
+                    });
+  data.clear();
 }
 
-EventWorkspace::~EventWorkspace() { data.clear(); }
-
 /** Returns true if the EventWorkspace is safe for multithreaded operations.
  * WARNING: This is only true for OpenMP threading. EventWorkspace is NOT thread
  * safe with Poco threads or other threading mechanisms.
@@ -101,11 +120,7 @@ void EventWorkspace::init(const std::size_t &NVectors,
   // Make sure SOMETHING exists for all initialized spots.
   EventList el;
   el.setHistogram(edges);
-  for (size_t i = 0; i < NVectors; i++) {
-    data[i] = std::make_unique<EventList>(el);
-    data[i]->setMRU(mru.get());
-    data[i]->setSpectrumNo(specnum_t(i));
-  }
+  createEventLists(el);
 
   // Create axes.
   m_axes.resize(2);
@@ -125,17 +140,28 @@ void EventWorkspace::init(const HistogramData::Histogram &histogram) {
   data.resize(numberOfDetectorGroups());
   EventList el;
   el.setHistogram(histogram);
-  for (size_t i = 0; i < data.size(); i++) {
-    data[i] = std::make_unique<EventList>(el);
-    data[i]->setMRU(mru.get());
-    data[i]->setSpectrumNo(specnum_t(i));
-  }
+  createEventLists(el);
 
   m_axes.resize(2);
   m_axes[0] = std::make_unique<API::RefAxis>(this);
   m_axes[1] = std::make_unique<API::SpectraAxis>(this);
 }
 
+/** Fill the (resized) data with copies of an empty event list. This is done
+ * in parallel as workspaces can have millions of spectra.
+ * @param el :: the event list to copy, with the histogram to use
+ */
+void EventWorkspace::createEventLists(const EventList &el) {
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()),
+                    [this, &el](const tbb::blocked_range<size_t> &range) {
+                      for (size_t i = range.begin(); i < range.end(); ++i) {
+                        data[i] = std::make_unique<EventList>(el);
+                        data[i]->setMRU(mru.get());
+                        data[i]->setSpectrumNo(specnum_t(i));
+                      }
+                    });
+}
+
 /// The total size of the workspace
 /// @returns the number of single indexable items in the workspace
 size_t EventWorkspace::size() const {
@@ -454,15 +480,20 @@ void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
 /// @returns If the data is a histogram - always true for an eventWorkspace
 bool EventWorkspace::isHistogramData() const { return true; }
 
-/** Return how many entries in the Y MRU list are used.
- * Only used in tests. It only returns the 0-th MRU list size.
- * @return :: number of entries in the MRU list.
+/** Return how many event lists have histograms in the MRU.
+ * @return :: number of entries in the MRU.
  */
 size_t EventWorkspace::MRUSize() const { return mru->MRUSize(); }
 
 /** Clears the MRU lists */
 void EventWorkspace::clearMRU() const { mru->clear(); }
 
+/** Get the cache of the histograms generated from the event lists, e.g. to
+ * change its memory budget or look at its hit rate.
+ * @return :: the MRU of this workspace.
+ */
+EventWorkspaceMRU &EventWorkspace::getMRU() const { return *mru; }
+
 /// Returns the amount of memory used in bytes
 size_t EventWorkspace::getMemorySize() const {
   // TODO: Add the MRU buffer
@@ -628,13 +659,14 @@ class EventSortingTask {
 public:
   /// ctor
   EventSortingTask(const EventWorkspace *WS, EventSortType sortType,
+                   const std::vector<size_t> &indices,
                    Mantid::API::Progress *prog)
-      : m_sortType(sortType), m_WS(WS), prog(prog) {}
+      : m_sortType(sortType), m_WS(WS), m_indices(indices), prog(prog) {}
 
   // Execute the sort as specified.
   void operator()(const tbb::blocked_range<size_t> &range) const {
-    for (size_t wi = range.begin(); wi < range.end(); ++wi) {
-      m_WS->getSpectrum(wi).sort(m_sortType);
+    for (size_t i = range.begin(); i < range.end(); ++i) {
+      m_WS->getSpectrum(m_indices[i]).sort(m_sortType);
     }
     // Report progress
     if (prog)
@@ -646,6 +678,8 @@ private:
   EventSortType m_sortType;
   /// EventWorkspace on which to sort
   const EventWorkspace *m_WS;
+  /// Workspace indices of the event lists to sort
+  const std::vector<size_t> &m_indices;
   /// Optional Progress dialog.
   Mantid::API::Progress *prog;
 };
@@ -678,9 +712,51 @@ void EventWorkspace::sortAll(EventSortType sortType,
     return;
   }
 
-  // Create the thread pool, and optimize by doing the longest sorts first.
-  EventSortingTask task(this, sortType, prog);
-  tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()), task);
+  // Lists that are already sorted are skipped. Each list chooses its own
+  // algorithm from its size and current order (see EventSorting).
+  std::vector<size_t> indices;
+  indices.reserve(data.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (data[i]->getSortType() != sortType)
+      indices.emplace_back(i);
+  }
+  // Optimize by doing the longest sorts first, so that a long list does not
+  // end up running alone at the end.
+  std::stable_sort(indices.begin(), indices.end(),
+                   [this](const size_t lhs, const size_t rhs) {
+                     return data[lhs]->getNumberEvents() >
+                            data[rhs]->getNumberEvents();
+                   });
+
+  EventSortingTask task(this, sortType, indices, prog);
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, indices.size()), task);
+}
+
+/** Move the events of every event list to columnar storage, see
+ * EventList::packColumns().
+ */
+void EventWorkspace::packColumns() {
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()),
+                    [this](const tbb::blocked_range<size_t> &range) {
+                      for (size_t i = range.begin(); i < range.end(); ++i)
+                        data[i]->packColumns();
+                    });
+}
+
+/** Move the events of every event list to compact columnar storage, see
+ * EventList::packCompactColumns(). All lists index the same pulse table.
+ * @param pulseTable :: sorted, unique pulse times in nanoseconds including the
+ * pulse time of every event in the workspace. Lists whose pulse times are not
+ * all in the table, or every list if it is null, build their own table.
+ */
+void EventWorkspace::packCompactEvents(
+    const std::shared_ptr<const std::vector<int64_t>> &pulseTable) {
+  tbb::parallel_for(
+      tbb::blocked_range<size_t>(0, data.size()),
+      [this, &pulseTable](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+          data[i]->packCompactColumns(pulseTable);
+      });
 }
 
 /** Integrate all the spectra in the matrix workspace within the range given.
@@ -5,175 +5,289 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/System.h"
 
+#include <algorithm>
+
 namespace Mantid {
 namespace DataObjects {
 
-EventWorkspaceMRU::~EventWorkspaceMRU() {
-  // Make sure you free up the memory in the MRUs
-  {
-    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->clear();
-      }
-    }
-  }
-  Poco::ScopedWriteRWLock _lock2(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
-    }
-  }
-}
+namespace {
+/// Key of the memory budget of the cache, in megabytes, in the configuration
+const std::string MEMORY_BUDGET_KEY = "EventWorkspace.CacheMB";
+/// Memory budget, in megabytes, if none is set in the configuration
+constexpr int DEFAULT_MEMORY_BUDGET_MB = 256;
 
-//---------------------------------------------------------------------------
-/** This function makes sure that there are enough data
- * buffers (MRU's) for E for the number of threads requested.
- * @param thread_num :: thread number that wants a MRU buffer
- */
-void EventWorkspaceMRU::ensureEnoughBuffersE(size_t thread_num) const {
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  if (m_bufferedDataE.size() <= thread_num) {
-    m_bufferedDataE.resize(thread_num + 1);
-    for (auto &data : m_bufferedDataE) {
-      if (!data)
-        data = std::make_unique<mru_listE>(
-            50); // Create a MRU list with this many entries.
-    }
-  }
+size_t defaultMemoryBudget() {
+  const auto megabytes =
+      Kernel::ConfigService::Instance().getValue<int>(MEMORY_BUDGET_KEY);
+  return static_cast<size_t>(
+             std::max(0, megabytes.get_value_or(DEFAULT_MEMORY_BUDGET_MB))) *
+         1024 * 1024;
 }
-//---------------------------------------------------------------------------
-/** This function makes sure that there are enough data
- * buffers (MRU's) for Y for the number of threads requested.
- * @param thread_num :: thread number that wants a MRU buffer
+} // namespace
+
+/// Constructor, with the memory budget set in the configuration
+EventWorkspaceMRU::EventWorkspaceMRU()
+    : EventWorkspaceMRU(defaultMemoryBudget()) {}
+
+/** Constructor
+ * @param memoryBudget :: memory the cached histograms may use, in bytes
  */
-void EventWorkspaceMRU::ensureEnoughBuffersY(size_t thread_num) const {
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-  if (m_bufferedDataY.size() <= thread_num) {
-    m_bufferedDataY.resize(thread_num + 1);
-    for (auto &data : m_bufferedDataY) {
-      if (!data)
-        data = std::make_unique<mru_listY>(
-            50); // Create a MRU list with this many entries.
-    }
-  }
-}
+EventWorkspaceMRU::EventWorkspaceMRU(const size_t memoryBudget)
+    : m_memoryBudget(memoryBudget) {}
 
 //---------------------------------------------------------------------------
-/// Clear all the data in the MRU buffers
+/// Clear all the cached and pinned histograms
 void EventWorkspaceMRU::clear() {
-  {
-    // Make sure you free up the memory in the MRUs
-    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->clear();
-      }
-    }
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    m_memorySize -= shard.memorySize;
+    shard.memorySize = 0;
+    shard.entries.clear();
+    shard.lookup.clear();
   }
 
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
-    }
+  Poco::ScopedReadRWLock _lock(m_pinsMutex);
+  for (auto &pins : m_pins) {
+    std::lock_guard<std::mutex> lock(pins->mutex);
+    std::fill(pins->y.begin(), pins->y.end(), YType(nullptr));
+    std::fill(pins->e.begin(), pins->e.end(), EType(nullptr));
   }
 }
 
 //---------------------------------------------------------------------------
-/** Find a Y histogram in the MRU
+/** Find a Y histogram in the cache
  *
- * @param thread_num :: number of the thread in which this is run
- * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @param index :: event list the histogram was generated from
+ * @param version :: current version of the event list
+ * @return the histogram; NULL if not found.
  */
-Kernel::cow_ptr<HistogramData::HistogramY>
-EventWorkspaceMRU::findY(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto result = m_bufferedDataY[thread_num]->find(
-      reinterpret_cast<std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
+EventWorkspaceMRU::YType EventWorkspaceMRU::findY(const EventList *index,
+                                                  const uint64_t version) {
+  auto &shard = m_shards[shardIndex(index)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto entry = findEntry(shard, index, version);
+  if (entry && entry->y) {
+    ++m_hits;
+    return entry->y;
+  }
+  ++m_misses;
   return YType(nullptr);
 }
 
-/** Find a Y histogram in the MRU
+/** Find an E histogram in the cache
  *
- * @param thread_num :: number of the thread in which this is run
- * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @param index :: event list the histogram was generated from
+ * @param version :: current version of the event list
+ * @return the histogram; NULL if not found.
  */
-Kernel::cow_ptr<HistogramData::HistogramE>
-EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto result = m_bufferedDataE[thread_num]->find(
-      reinterpret_cast<std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
+EventWorkspaceMRU::EType EventWorkspaceMRU::findE(const EventList *index,
+                                                  const uint64_t version) {
+  auto &shard = m_shards[shardIndex(index)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto entry = findEntry(shard, index, version);
+  if (entry && entry->e) {
+    ++m_hits;
+    return entry->e;
+  }
+  ++m_misses;
   return EType(nullptr);
 }
 
-/** Insert a new histogram into the MRU
+/** Insert a new histogram into the cache, dropping the least recently used
+ * ones of its shard if the shard's share of the memory budget is exceeded.
  *
- * @param thread_num :: thread being accessed
  * @param data :: the new data
- * @param index :: index of the data to insert
+ * @param index :: event list the histogram was generated from
+ * @param version :: version of the event list it was generated from
  */
-void EventWorkspaceMRU::insertY(size_t thread_num, YType data,
-                                const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto yWithMarker = std::make_shared<TypeWithMarker<YType>>(
-      reinterpret_cast<std::uintptr_t>(index));
-  yWithMarker->m_data = std::move(data);
-  m_bufferedDataY[thread_num]->insert(yWithMarker);
-  // the memory is cleared automatically due to being a smart_ptr
+void EventWorkspaceMRU::insertY(YType data, const EventList *index,
+                                const uint64_t version) {
+  auto &shard = m_shards[shardIndex(index)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto &entry = entryToInsert(shard, index, version);
+  entry.y = std::move(data);
+  updateMemory(shard, entry);
+  evict(shard, index);
 }
 
-/** Insert a new histogram into the MRU
+/** Insert a new histogram into the cache, dropping the least recently used
+ * ones of its shard if the shard's share of the memory budget is exceeded.
  *
- * @param thread_num :: thread being accessed
  * @param data :: the new data
- * @param index :: index of the data to insert
+ * @param index :: event list the histogram was generated from
+ * @param version :: version of the event list it was generated from
  */
-void EventWorkspaceMRU::insertE(size_t thread_num, EType data,
-                                const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto eWithMarker = std::make_shared<TypeWithMarker<EType>>(
-      reinterpret_cast<std::uintptr_t>(index));
-  eWithMarker->m_data = std::move(data);
-  auto oldData = m_bufferedDataE[thread_num]->insert(eWithMarker);
-  // And clear up the memory of the old one, if it is dropping out.
+void EventWorkspaceMRU::insertE(EType data, const EventList *index,
+                                const uint64_t version) {
+  auto &shard = m_shards[shardIndex(index)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto &entry = entryToInsert(shard, index, version);
+  entry.e = std::move(data);
+  updateMemory(shard, entry);
+  evict(shard, index);
 }
 
-/** Delete any entries in the MRU at the given index
+/** Keep a histogram returned by reference alive for the next PINS_PER_THREAD
+ * histograms pinned by the same thread.
+ *
+ * @param thread_num :: number of the thread in which this is run
+ * @param data :: the histogram
+ */
+void EventWorkspaceMRU::pinY(const size_t thread_num, YType data) {
+  auto &pins = pinsFor(thread_num);
+  std::lock_guard<std::mutex> lock(pins.mutex);
+  pins.y[pins.nextY] = std::move(data);
+  pins.nextY = (pins.nextY + 1) % PINS_PER_THREAD;
+}
+
+/** Keep a histogram returned by reference alive for the next PINS_PER_THREAD
+ * histograms pinned by the same thread.
+ *
+ * @param thread_num :: number of the thread in which this is run
+ * @param data :: the histogram
+ */
+void EventWorkspaceMRU::pinE(const size_t thread_num, EType data) {
+  auto &pins = pinsFor(thread_num);
+  std::lock_guard<std::mutex> lock(pins.mutex);
+  pins.e[pins.nextE] = std::move(data);
+  pins.nextE = (pins.nextE + 1) % PINS_PER_THREAD;
+}
+
+/** Delete any entries in the cache at the given index
  *
  * @param index :: index to delete.
  */
 void EventWorkspaceMRU::deleteIndex(const EventList *index) {
-  {
-    Poco::ScopedReadRWLock _lock1(m_changeMruListsMutexE);
-    for (auto &data : m_bufferedDataE) {
-      if (data) {
-        data->deleteIndex(reinterpret_cast<std::uintptr_t>(index));
-      }
-    }
+  auto &shard = m_shards[shardIndex(index)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto it = shard.lookup.find(index);
+  if (it != shard.lookup.end())
+    eraseEntry(shard, it->second);
+}
+
+size_t EventWorkspaceMRU::MRUSize() const {
+  size_t size = 0;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size += shard.entries.size();
   }
-  Poco::ScopedReadRWLock _lock2(m_changeMruListsMutexY);
-  for (auto &data : m_bufferedDataY) {
-    if (data) {
-      data->deleteIndex(reinterpret_cast<std::uintptr_t>(index));
-    }
+  return size;
+}
+
+/** Set the memory the cached histograms may use, dropping the least recently
+ * used ones if needed.
+ * @param memoryBudget :: the budget, in bytes
+ */
+void EventWorkspaceMRU::setMemoryBudget(const size_t memoryBudget) {
+  m_memoryBudget = memoryBudget;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    evict(shard, nullptr);
   }
 }
 
-size_t EventWorkspaceMRU::MRUSize() const {
-  if (m_bufferedDataY.empty()) {
-    return 0;
-  } else {
-    return this->m_bufferedDataY.front()->size();
+//---------------------------------------------------------------------------
+/// Shard of the cache holding the histograms of an event list
+size_t EventWorkspaceMRU::shardIndex(const EventList *index) const {
+  // Mix the bits of the address, whose lowest bits are mostly zero
+  const auto address = static_cast<uint64_t>(
+      reinterpret_cast<std::uintptr_t>(index));
+  return static_cast<size_t>((address * 0x9E3779B97F4A7C15ull) >> 32) %
+         NUM_SHARDS;
+}
+
+/** Find the entry of an event list, and make it the most recently used one.
+ * An entry generated from another version of the list is erased.
+ * @return the entry; NULL if not found.
+ */
+EventWorkspaceMRU::Entry *EventWorkspaceMRU::findEntry(Shard &shard,
+                                                       const EventList *index,
+                                                       const uint64_t version) {
+  const auto it = shard.lookup.find(index);
+  if (it == shard.lookup.end())
+    return nullptr;
+  if (it->second->version != version) {
+    eraseEntry(shard, it->second);
+    return nullptr;
+  }
+  shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+  return &shard.entries.front();
+}
+
+/** Get the entry in which to store a histogram of an event list, as the most
+ * recently used one. The histograms of another version of the list are
+ * dropped.
+ */
+EventWorkspaceMRU::Entry &
+EventWorkspaceMRU::entryToInsert(Shard &shard, const EventList *index,
+                                 const uint64_t version) {
+  const auto it = shard.lookup.find(index);
+  if (it == shard.lookup.end()) {
+    shard.entries.push_front(
+        {index, version, YType(nullptr), EType(nullptr), 0});
+    shard.lookup.emplace(index, shard.entries.begin());
+    return shard.entries.front();
+  }
+  shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+  auto &entry = shard.entries.front();
+  if (entry.version != version) {
+    entry.version = version;
+    entry.y = YType(nullptr);
+    entry.e = EType(nullptr);
+    updateMemory(shard, entry);
+  }
+  return entry;
+}
+
+/// Erase an entry, releasing its memory
+void EventWorkspaceMRU::eraseEntry(Shard &shard,
+                                   std::list<Entry>::iterator entry) {
+  m_memorySize -= entry->bytes;
+  shard.memorySize -= entry->bytes;
+  shard.lookup.erase(entry->index);
+  shard.entries.erase(entry);
+}
+
+/// Update the memory used by an entry after its histograms changed
+void EventWorkspaceMRU::updateMemory(Shard &shard, Entry &entry) {
+  size_t bytes = 0;
+  if (entry.y)
+    bytes += entry.y->size() * sizeof(double);
+  if (entry.e)
+    bytes += entry.e->size() * sizeof(double);
+  m_memorySize += bytes;
+  m_memorySize -= entry.bytes;
+  shard.memorySize += bytes;
+  shard.memorySize -= entry.bytes;
+  entry.bytes = bytes;
+}
+
+/** Drop the least recently used entries of a shard until it meets its share
+ * of the memory budget. The shard must be locked.
+ * @param shard :: the shard
+ * @param keep :: event list whose entry, just inserted, must be kept
+ */
+void EventWorkspaceMRU::evict(Shard &shard, const EventList *keep) {
+  const size_t budget = m_memoryBudget / NUM_SHARDS;
+  while (shard.memorySize > budget && !shard.entries.empty() &&
+         shard.entries.back().index != keep)
+    eraseEntry(shard, std::prev(shard.entries.end()));
+}
+
+/// Pinned histograms of a thread, created if needed
+EventWorkspaceMRU::Pins &EventWorkspaceMRU::pinsFor(const size_t thread_num) {
+  {
+    Poco::ScopedReadRWLock _lock(m_pinsMutex);
+    if (thread_num < m_pins.size())
+      return *m_pins[thread_num];
   }
+  Poco::ScopedWriteRWLock _lock(m_pinsMutex);
+  while (m_pins.size() <= thread_num)
+    m_pins.emplace_back(std::make_unique<Pins>());
+  return *m_pins[thread_num];
 }
 
 } // namespace DataObjects
@@ -0,0 +1,130 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/EventBinner.h"
+#include "MantidDataObjects/EventList.h"
+#include <cxxtest/TestSuite.h>
+
+#include <cmath>
+#include <random>
+
+using namespace Mantid::DataObjects;
+using Mantid::MantidVec;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+class EventBinnerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventBinnerTest *createSuite() { return new EventBinnerTest(); }
+  static void destroySuite(EventBinnerTest *suite) { delete suite; }
+
+  void test_spacing() {
+    TS_ASSERT_EQUALS(EventBinner(linearEdges()).spacing(),
+                     EventBinner::Spacing::Linear);
+    TS_ASSERT_EQUALS(EventBinner(logEdges()).spacing(),
+                     EventBinner::Spacing::Logarithmic);
+    const MantidVec arbitrary{0., 1., 3., 7.};
+    TS_ASSERT(!EventBinner(arbitrary).isClosedForm());
+    const MantidVec descending{3., 2., 1.};
+    TS_ASSERT(!EventBinner(descending).isClosedForm());
+    TS_ASSERT(!EventBinner(MantidVec{1.}).isClosedForm());
+  }
+
+  void test_findBins_matches_search_in_edges() {
+    for (const auto &X : {linearEdges(), logEdges()}) {
+      EventBinner binner(X);
+      // Include the edges themselves, which are the values most prone to
+      // rounding, and values outside the histogram
+      std::vector<double> values(X);
+      values.emplace_back(X.front() - 1.);
+      values.emplace_back(X.back() + 1.);
+      values.emplace_back(std::nan(""));
+      std::uniform_real_distribution<double> distribution(X.front(), X.back());
+      std::mt19937 generator(4);
+      for (size_t i = 0; i < 1000; ++i)
+        values.emplace_back(distribution(generator));
+
+      std::vector<int64_t> bins(values.size());
+      binner.findBins(values.data(), values.size(), bins.data());
+      for (size_t i = 0; i < values.size(); ++i) {
+        int64_t expected = -1;
+        if (values[i] >= X.front() && values[i] < X.back())
+          expected = std::distance(
+                         X.cbegin(),
+                         std::upper_bound(X.cbegin(), X.cend(), values[i])) -
+                     1;
+        TS_ASSERT_EQUALS(bins[i], expected);
+      }
+    }
+  }
+
+  void test_EventList_histogram_does_not_sort_for_closed_form_edges() {
+    std::vector<TofEvent> events;
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> tof(0., 1200.);
+    for (size_t i = 0; i < 10000; ++i)
+      events.emplace_back(tof(generator), DateAndTime(0));
+    EventList unsorted(events);
+    EventList sorted(events);
+    sorted.sortTof();
+
+    for (const auto &X : {linearEdges(), logEdges()}) {
+      MantidVec Y1, E1, Y2, E2;
+      unsorted.generateHistogram(X, Y1, E1);
+      sorted.generateHistogram(X, Y2, E2);
+      TS_ASSERT_EQUALS(Y1, Y2);
+      TS_ASSERT_EQUALS(E1, E2);
+    }
+    TS_ASSERT_EQUALS(unsorted.getSortType(), UNSORTED);
+  }
+
+private:
+  MantidVec linearEdges() {
+    MantidVec X;
+    for (size_t i = 0; i <= 1000; ++i)
+      X.emplace_back(0.1 + static_cast<double>(i) * 1.1);
+    return X;
+  }
+
+  MantidVec logEdges() {
+    MantidVec X{10.};
+    while (X.back() < 1000.)
+      X.emplace_back(X.back() * 1.004);
+    return X;
+  }
+};
+
+class EventBinnerTestPerformance : public CxxTest::TestSuite {
+public:
+  static EventBinnerTestPerformance *createSuite() {
+    return new EventBinnerTestPerformance();
+  }
+  static void destroySuite(EventBinnerTestPerformance *suite) { delete suite; }
+
+  EventBinnerTestPerformance() {
+    std::mt19937 generator(6);
+    std::uniform_real_distribution<double> tof(0., 20000.);
+    std::vector<TofEvent> events;
+    for (size_t i = 0; i < 5000000; ++i)
+      events.emplace_back(tof(generator), DateAndTime(0));
+    m_list = EventList(events);
+    for (size_t i = 0; i <= 10000; ++i)
+      m_X.emplace_back(static_cast<double>(i) * 2.);
+  }
+
+  void test_histogram_unsorted_events_with_linear_edges() {
+    MantidVec Y, E;
+    m_list.generateHistogram(m_X, Y, E);
+  }
+
+private:
+  EventList m_list;
+  MantidVec m_X;
+};
@@ -0,0 +1,171 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventList.h"
+#include <cxxtest/TestSuite.h>
+
+#include <cmath>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+class EventColumnsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventColumnsTest *createSuite() { return new EventColumnsTest(); }
+  static void destroySuite(EventColumnsTest *suite) { delete suite; }
+
+  void test_pack_and_unpack_tof_events() {
+    const auto events = makeTofEvents();
+    EventColumns columns(events);
+    TS_ASSERT_EQUALS(columns.getEventType(), TOF);
+    TS_ASSERT_EQUALS(columns.size(), events.size());
+    TS_ASSERT(columns.weights().empty());
+
+    std::vector<TofEvent> unpacked;
+    columns.unpack(unpacked);
+    TS_ASSERT_EQUALS(unpacked, events);
+
+    std::vector<WeightedEvent> wrongType;
+    TS_ASSERT_THROWS(columns.unpack(wrongType), const std::runtime_error &);
+  }
+
+  void test_pack_and_unpack_weighted_events() {
+    std::vector<WeightedEvent> events;
+    for (const auto &event : makeTofEvents())
+      events.emplace_back(event.tof(), event.pulseTime(), 2.0, 4.0);
+    EventColumns columns(events);
+    TS_ASSERT_EQUALS(columns.getEventType(), WEIGHTED);
+
+    std::vector<WeightedEvent> unpacked;
+    columns.unpack(unpacked);
+    TS_ASSERT_EQUALS(unpacked, events);
+  }
+
+  void test_sortTof_permutes_every_column() {
+    EventColumns columns(makeTofEvents());
+    columns.sortTof();
+    const auto &tofs = columns.tofs();
+    TS_ASSERT(std::is_sorted(tofs.cbegin(), tofs.cend()));
+    // The pulse time of each event travels with its tof
+    for (size_t i = 0; i < tofs.size(); ++i)
+      TS_ASSERT_EQUALS(columns.pulseTimes()[i],
+                       static_cast<int64_t>(tofs[i]) * 10);
+  }
+
+  void test_generateHistogram_matches_EventList() {
+    EventList reference(makeTofEvents());
+    EventList columnar(makeTofEvents());
+    columnar.packColumns();
+    TS_ASSERT(columnar.hasColumns());
+
+    const MantidVec X{0., 10., 25., 50., 75.};
+    MantidVec Y1, E1, Y2, E2;
+    reference.generateHistogram(X, Y1, E1);
+    columnar.generateHistogram(X, Y2, E2);
+    TS_ASSERT_EQUALS(Y1, Y2);
+    TS_ASSERT_EQUALS(E1, E2);
+    // Histogramming does not need the events to be unpacked
+    TS_ASSERT(columnar.hasColumns());
+  }
+
+  void test_convertTof_and_filterByPulseTime_keep_columns() {
+    EventList list(makeTofEvents());
+    list.packColumns();
+    list.convertTof(2.0, 1.0);
+    TS_ASSERT(list.hasColumns());
+
+    EventList output;
+    list.filterByPulseTime(DateAndTime(100), DateAndTime(300), output);
+    TS_ASSERT(output.hasColumns());
+    TS_ASSERT_EQUALS(output.getNumberEvents(), 20);
+    const auto &filtered = output.getEvents();
+    TS_ASSERT(!output.hasColumns());
+    for (const auto &event : filtered) {
+      TS_ASSERT_LESS_THAN_EQUALS(100, event.pulseTime().totalNanoseconds());
+      TS_ASSERT_LESS_THAN(event.pulseTime().totalNanoseconds(), 300);
+      TS_ASSERT_EQUALS(event.tof(),
+                       static_cast<double>(
+                           event.pulseTime().totalNanoseconds() / 10) *
+                               2.0 +
+                           1.0);
+    }
+  }
+
+  void test_other_operations_unpack_transparently() {
+    EventList list(makeTofEvents());
+    list.packColumns();
+    list.addPulsetime(1.0);
+    TS_ASSERT(!list.hasColumns());
+    TS_ASSERT_EQUALS(list.getNumberEvents(), 50);
+    TS_ASSERT_EQUALS(list.getEvents().size(), 50);
+  }
+
+  void test_compact_halves_tof_event_memory() {
+    EventColumns columns(makeTofEvents());
+    const auto fullSize = columns.getMemorySize();
+    auto table = std::make_shared<EventColumns::PulseTable>();
+    for (int64_t i = 0; i < 50; ++i)
+      table->emplace_back(i * 10);
+    columns.compact(table);
+    TS_ASSERT(columns.isCompact());
+    TS_ASSERT_EQUALS(columns.pulseTable(), table);
+    TS_ASSERT_LESS_THAN_EQUALS(2 * (columns.getMemorySize() - sizeof(columns)),
+                               fullSize - sizeof(columns));
+
+    std::vector<TofEvent> unpacked;
+    columns.unpack(unpacked);
+    TS_ASSERT_EQUALS(unpacked, makeTofEvents());
+  }
+
+  void test_compact_builds_own_table_if_pulse_time_is_not_in_table() {
+    EventColumns columns(makeTofEvents());
+    auto table = std::make_shared<EventColumns::PulseTable>(1, 0);
+    TS_ASSERT_THROWS_NOTHING(columns.compact(table));
+    TS_ASSERT(columns.isCompact());
+    TS_ASSERT_DIFFERS(columns.pulseTable(), table);
+    TS_ASSERT_EQUALS(columns.size(), 50);
+
+    std::vector<TofEvent> unpacked;
+    columns.unpack(unpacked);
+    TS_ASSERT_EQUALS(unpacked, makeTofEvents());
+  }
+
+  void test_compact_EventList_operations() {
+    EventList reference(makeTofEvents());
+    EventList compact(makeTofEvents());
+    compact.packCompactColumns();
+
+    const MantidVec X{0., 10., 25., 50., 75.};
+    MantidVec Y1, E1, Y2, E2;
+    reference.generateHistogram(X, Y1, E1);
+    compact.generateHistogram(X, Y2, E2);
+    TS_ASSERT_EQUALS(Y1, Y2);
+    TS_ASSERT_EQUALS(E1, E2);
+
+    EventList output;
+    compact.filterByPulseTime(DateAndTime(100), DateAndTime(300), output);
+    TS_ASSERT_EQUALS(output.getNumberEvents(), 20);
+    TS_ASSERT_EQUALS(output.getPulseTimeMin(), DateAndTime(100));
+    TS_ASSERT_EQUALS(output.getPulseTimeMax(), DateAndTime(290));
+  }
+
+private:
+  /// 50 events in reverse TOF order; the pulse time is 10 * tof
+  std::vector<TofEvent> makeTofEvents() {
+    std::vector<TofEvent> events;
+    for (int i = 49; i >= 0; --i)
+      events.emplace_back(static_cast<double>(i), DateAndTime(int64_t{i * 10}));
+    return events;
+  }
+};
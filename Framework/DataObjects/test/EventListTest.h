@@ -1917,6 +1917,194 @@ public:
     return;
   }
 
+  //-----------------------------------------------------------------------------------------------
+  /** Split events to many targets at once, with the outputs given as a vector
+   * indexed by target + 1
+   */
+  void test_splitByFullTime_to_many_outputs() {
+    fake_uniform_time_sns_data();
+
+    // 90 of 100 targets get 10 pulses each, pulses from 900 are after the
+    // splitters
+    const int numTargets = 100;
+    std::vector<EventList> lists(numTargets + 1);
+    std::vector<EventList *> outputs;
+    for (auto &list : lists)
+      outputs.emplace_back(&list);
+    TimeSplitterType split;
+    std::vector<int64_t> vec_splitTimes;
+    std::vector<int> vec_splitGroup;
+    // Event times are whole microseconds, so are never on the boundaries of
+    // the vector splitters, which differ in how they treat them
+    for (int i = 0; i < 90; ++i) {
+      split.emplace_back(
+          SplittingInterval(i * 10000000, (i + 1) * 10000000, i));
+      vec_splitTimes.emplace_back(i * 10000000 - 1);
+      vec_splitGroup.emplace_back(i);
+    }
+    vec_splitTimes.emplace_back(900000000 - 1);
+
+    // Events after the last splitter are dropped
+    el.splitByFullTime(split, outputs, false, 1.0, 0.0);
+    checkManyOutputs(outputs, 0);
+    el.splitByPulseTime(split, outputs);
+    checkManyOutputs(outputs, 0);
+    // Fewer splitters than events: the splitters are walked with the events
+    el.splitByFullTimeMatrixSplitter(vec_splitTimes, vec_splitGroup, outputs,
+                                     false, 1.0, 0.0);
+    checkManyOutputs(outputs, 0);
+    // Pad the splitters to more than the events: each event is searched for,
+    // and the events outside the splitters go to the first output
+    for (int i = 0; i < 1000; ++i) {
+      vec_splitTimes.emplace_back(900000001 + i);
+      vec_splitGroup.emplace_back(-1);
+    }
+    el.splitByFullTimeMatrixSplitter(vec_splitTimes, vec_splitGroup, outputs,
+                                     false, 1.0, 0.0);
+    checkManyOutputs(outputs, 100);
+
+    // Events in a target without an output are an error
+    outputs[5] = nullptr;
+    TS_ASSERT_THROWS(el.splitByFullTime(split, outputs, false, 1.0, 0.0),
+                     const std::runtime_error &);
+  }
+
+  //-----------------------------------------------------------------------------------------------
+  /** Split events lazily: the outputs select the events of the list, which
+   * are shared rather than copied, and only copy them when they are modified
+   */
+  void test_splitByFullTime_lazy() {
+    fake_uniform_time_sns_data();
+    TimeSplitterType split;
+    for (int i = 0; i < 10; ++i)
+      split.emplace_back(
+          SplittingInterval(i * 100000000, (i + 1) * 100000000, i % 3));
+    std::vector<EventList> copied(4), selected(4);
+    std::vector<EventList *> copiedOutputs, selectedOutputs;
+    for (size_t i = 0; i < copied.size(); ++i) {
+      copiedOutputs.emplace_back(&copied[i]);
+      selectedOutputs.emplace_back(&selected[i]);
+    }
+
+    el.splitByFullTime(split, copiedOutputs, false, 1.0, 0.0);
+    const EventList input(el);
+    el.splitByFullTime(split, selectedOutputs, false, 1.0, 0.0, true);
+    // The events of the input are shared with the outputs, not copied
+    TS_ASSERT(el.hasSelection());
+    TS_ASSERT_EQUALS(el, input);
+    // Modifying the input copies its events and leaves the outputs as they are
+    el.addTof(1.0);
+    TS_ASSERT(!el.hasSelection());
+    const std::vector<MantidVec> binnings{{0., 250., 500., 750., 1000.},
+                                          {0., 100., 250., 600., 1000.}};
+    MantidVec Y, E, expectedY, expectedE;
+    for (size_t i = 1; i < selected.size(); ++i) {
+      TS_ASSERT(selected[i].hasSelection());
+      // Counting the events does not copy them
+      TS_ASSERT_EQUALS(selected[i].getNumberEvents(),
+                       copied[i].getNumberEvents());
+      TS_ASSERT_EQUALS(selected[i].getSortType(), PULSETIMETOF_SORT);
+      // Nor does reading them
+      for (const auto &X : binnings) {
+        selected[i].generateHistogram(X, Y, E);
+        copied[i].generateHistogram(X, expectedY, expectedE);
+        TS_ASSERT_EQUALS(Y, expectedY);
+        TS_ASSERT_EQUALS(E, expectedE);
+      }
+      TS_ASSERT_EQUALS(selected[i].getTofs(), copied[i].getTofs());
+      TS_ASSERT_EQUALS(selected[i].getTofMax(), copied[i].getTofMax());
+      TS_ASSERT_EQUALS(selected[i], copied[i]);
+      TS_ASSERT(selected[i].hasSelection());
+      // Copies of the output share the selection
+      EventList copy(selected[i]);
+      TS_ASSERT(copy.hasSelection());
+      // Modifying the events copies them
+      copy.addTof(1.0);
+      TS_ASSERT(!copy.hasSelection());
+      TS_ASSERT(selected[i].hasSelection());
+      TS_ASSERT_EQUALS(selected[i].getEvents(), copied[i].getEvents());
+      TS_ASSERT(!selected[i].hasSelection());
+    }
+    // The outputs are independent of the input once split
+    el.clear();
+    TS_ASSERT_EQUALS(selected[1].getNumberEvents(),
+                     copied[1].getNumberEvents());
+  }
+
+  void test_splitByFullTime_lazy_twice() {
+    fake_uniform_time_sns_data();
+    TimeSplitterType split;
+    for (int i = 0; i < 10; ++i)
+      split.emplace_back(
+          SplittingInterval(i * 100000000, (i + 1) * 100000000, i % 3));
+    std::vector<EventList> copied(4), first(4), second(4);
+    std::vector<EventList *> copiedOutputs, firstOutputs, secondOutputs;
+    for (size_t i = 0; i < copied.size(); ++i) {
+      copiedOutputs.emplace_back(&copied[i]);
+      firstOutputs.emplace_back(&first[i]);
+      secondOutputs.emplace_back(&second[i]);
+    }
+    el.splitByFullTime(split, copiedOutputs, false, 1.0, 0.0);
+
+    const EventList &input = el;
+    input.splitByFullTime(split, firstOutputs, false, 1.0, 0.0, true);
+    // The events shared by the first split are shared again
+    input.splitByFullTime(split, secondOutputs, false, 1.0, 0.0, true);
+    TS_ASSERT(input.hasSelection());
+    for (size_t i = 1; i < copied.size(); ++i) {
+      TS_ASSERT(first[i].hasSelection());
+      TS_ASSERT(second[i].hasSelection());
+      TS_ASSERT_EQUALS(first[i], copied[i]);
+      TS_ASSERT_EQUALS(second[i], copied[i]);
+    }
+  }
+
+  void test_selectFrom_checks_ranges() {
+    fake_uniform_time_sns_data();
+    auto parent = std::make_shared<const EventList>(el);
+    EventList selection;
+    TS_ASSERT_THROWS(selection.selectFrom(parent, {{10, 20}, {15, 30}}),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(selection.selectFrom(parent, {{990, 1001}}),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS_NOTHING(
+        selection.selectFrom(parent, {{10, 20}, {20, 30}}));
+    TS_ASSERT_EQUALS(selection.getNumberEvents(), 20);
+    TS_ASSERT_EQUALS(selection.getEvent(10), el.getEvent(20));
+  }
+
+  void test_selectFrom_adds_to_existing_events() {
+    fake_uniform_time_sns_data();
+    auto parent = std::make_shared<const EventList>(el);
+    EventList output;
+    output += TofEvent(1.5, 10);
+    output += TofEvent(2.5, 20);
+    output.selectFrom(parent, {{10, 20}});
+    // The events already in the output are kept
+    TS_ASSERT(!output.hasSelection());
+    TS_ASSERT_EQUALS(output.getNumberEvents(), 12);
+    TS_ASSERT_EQUALS(output.getEvent(0), WeightedEvent(TofEvent(1.5, 10)));
+    TS_ASSERT_EQUALS(output.getEvent(2), el.getEvent(10));
+    TS_ASSERT_EQUALS(output.getEvent(11), el.getEvent(19));
+  }
+
+  void test_selectFrom_merges_ranges_of_the_same_list() {
+    fake_uniform_time_sns_data();
+    auto parent = std::make_shared<const EventList>(el);
+    EventList output;
+    output.selectFrom(parent, {{30, 40}});
+    output.selectFrom(parent, {{10, 20}});
+    TS_ASSERT(output.hasSelection());
+    TS_ASSERT_EQUALS(output.getNumberEvents(), 20);
+    TS_ASSERT_EQUALS(output.getEvent(0), el.getEvent(10));
+    TS_ASSERT_EQUALS(output.getEvent(10), el.getEvent(30));
+    // Overlapping ranges are copied instead
+    output.selectFrom(parent, {{15, 16}});
+    TS_ASSERT(!output.hasSelection());
+    TS_ASSERT_EQUALS(output.getNumberEvents(), 21);
+    TS_ASSERT_EQUALS(output.getEvent(20), el.getEvent(15));
+  }
+
   //-----------------------------------------------------------------------------------------------
   /** Test method to split events by full time (pulse + tof) withtout correction
    * on TOF
@@ -2197,6 +2385,27 @@ public:
     }   // starting event type
   }
 
+  void test_compressEvents_parallel() {
+    // Groups of 7 close events, far enough apart to be split between threads
+    const size_t groupSize = 7;
+    const size_t numGroups = EventList::PARALLEL_COMPRESS_SIZE / groupSize + 1;
+    std::vector<TofEvent> events;
+    for (size_t group = numGroups; group-- > 0;)
+      for (size_t i = 0; i < groupSize; ++i)
+        events.emplace_back(static_cast<double>(group) + 0.01 * i, 0);
+    el = EventList(events);
+
+    EventList out;
+    TS_ASSERT_THROWS_NOTHING(el.compressEvents(0.1, &out));
+    TS_ASSERT_EQUALS(out.getNumberEvents(), numGroups);
+    TS_ASSERT(out.isSortedByTof());
+    const auto &compressed = out.getWeightedEventsNoTime();
+    for (size_t group = 0; group < compressed.size(); ++group) {
+      TS_ASSERT_DELTA(compressed[group].tof(), group + 0.03, 1e-6);
+      TS_ASSERT_EQUALS(compressed[group].weight(), groupSize);
+    }
+  }
+
   void test_compressFatEvents() {
     // no pulse time should throw an exception
     EventList el_notime_output;
@@ -2686,6 +2895,27 @@ public:
   //----------------------------------------------------------------------------------------------
   /** Fake uniform time data more close to SNS case
    */
+  /** Check the outputs of test_splitByFullTime_to_many_outputs
+   * @param outputs :: the outputs, indexed by target + 1
+   * @param numUnfiltered :: the number of events expected outside the
+   * splitters
+   */
+  void checkManyOutputs(const std::vector<EventList *> &outputs,
+                        size_t numUnfiltered) {
+    const size_t numFiltered = 90;
+    TS_ASSERT_EQUALS(outputs[0]->getNumberEvents(), numUnfiltered);
+    for (size_t target = 0; target + 1 < outputs.size(); ++target) {
+      const EventList *output = outputs[target + 1];
+      TS_ASSERT_EQUALS(output->getNumberEvents(),
+                       target < numFiltered ? 10 : 0);
+      if (target < numFiltered)
+        TS_ASSERT_EQUALS(output->getSortType(), PULSETIMETOF_SORT);
+      for (const auto &event : output->getEvents())
+        TS_ASSERT_EQUALS(event.pulseTime().totalNanoseconds() / 10000000,
+                         static_cast<int64_t>(target));
+    }
+  }
+
   void fake_uniform_time_sns_data() {
     // Clear the list
     el = EventList();
@@ -0,0 +1,120 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/EventSorting.h"
+#include <cxxtest/TestSuite.h>
+
+#include <random>
+
+using namespace Mantid::DataObjects;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+bool lessTof(const TofEvent &e1, const TofEvent &e2) {
+  return e1.tof() < e2.tof();
+}
+
+uint64_t tofKey(const TofEvent &event) {
+  return EventSorting::radixKey(event.tof());
+}
+
+/// Random events with negative and positive TOFs and a few pulses
+std::vector<TofEvent> makeRandomEvents(const size_t numEvents) {
+  std::mt19937 generator(12345);
+  std::uniform_real_distribution<double> tof(-100., 20000.);
+  std::uniform_int_distribution<int64_t> pulse(0, 20);
+  std::vector<TofEvent> events;
+  for (size_t i = 0; i < numEvents; ++i)
+    events.emplace_back(tof(generator), DateAndTime(pulse(generator)));
+  return events;
+}
+} // namespace
+
+class EventSortingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventSortingTest *createSuite() { return new EventSortingTest(); }
+  static void destroySuite(EventSortingTest *suite) { delete suite; }
+
+  void test_radixKey_preserves_order() {
+    const std::vector<double> values{-1e10, -2.5, -0.0, 0.0, 1e-300, 3.5, 1e9};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN_EQUALS(EventSorting::radixKey(values[i - 1]),
+                                 EventSorting::radixKey(values[i]));
+    TS_ASSERT_LESS_THAN(EventSorting::radixKey(int64_t{-5}),
+                        EventSorting::radixKey(int64_t{3}));
+  }
+
+  void test_radixSort_is_stable() {
+    auto events = makeRandomEvents(5000);
+    auto expected = events;
+    std::stable_sort(expected.begin(), expected.end(), lessTof);
+    EventSorting::radixSort(events, tofKey);
+    TS_ASSERT_EQUALS(events, expected);
+  }
+
+  void test_mergeSortedRuns() {
+    auto events = makeRandomEvents(3000);
+    for (size_t run = 0; run < 3; ++run)
+      std::sort(events.begin() + run * 1000, events.begin() + (run + 1) * 1000,
+                lessTof);
+    TS_ASSERT(EventSorting::mergeSortedRuns(events, lessTof));
+    TS_ASSERT(std::is_sorted(events.cbegin(), events.cend(), lessTof));
+  }
+
+  void test_mergeSortedRuns_gives_up_on_unsorted_events() {
+    auto events = makeRandomEvents(3000);
+    const auto original = events;
+    TS_ASSERT(!EventSorting::mergeSortedRuns(events, lessTof));
+    TS_ASSERT_EQUALS(events, original);
+  }
+
+  void test_EventList_sortPulseTimeTOF_from_any_order() {
+    for (const auto order : {UNSORTED, TOF_SORT, PULSETIME_SORT}) {
+      EventList list(makeRandomEvents(2000));
+      list.sort(order);
+      list.sortPulseTimeTOF();
+      const auto &events = list.getEvents();
+      for (size_t i = 1; i < events.size(); ++i) {
+        const auto &previous = events[i - 1];
+        const auto &event = events[i];
+        TS_ASSERT(previous.pulseTime() < event.pulseTime() ||
+                  (previous.pulseTime() == event.pulseTime() &&
+                   previous.tof() <= event.tof()));
+      }
+    }
+  }
+};
+
+class EventSortingTestPerformance : public CxxTest::TestSuite {
+public:
+  static EventSortingTestPerformance *createSuite() {
+    return new EventSortingTestPerformance();
+  }
+  static void destroySuite(EventSortingTestPerformance *suite) {
+    delete suite;
+  }
+
+  EventSortingTestPerformance() : m_events(makeRandomEvents(2000000)) {}
+
+  void test_sortTof() {
+    EventList list(m_events);
+    list.sortTof();
+  }
+
+  void test_sortPulseTimeTOF() {
+    EventList list(m_events);
+    list.sortPulseTimeTOF();
+  }
+
+private:
+  std::vector<TofEvent> m_events;
+};
@@ -10,9 +10,14 @@
 #include "MantidKernel/Timer.h"
 #include <cxxtest/TestSuite.h>
 
+#include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidKernel/make_cow.h"
 
 using namespace Mantid::DataObjects;
+using Mantid::HistogramData::HistogramE;
+using Mantid::HistogramData::HistogramY;
+using Mantid::Kernel::make_cow;
 
 class EventWorkspaceMRUTest : public CxxTest::TestSuite {
 public:
@@ -20,5 +25,68 @@ public:
     EventWorkspaceMRU mru;
     TS_ASSERT_THROWS_NOTHING(mru.MRUSize());
     TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.memorySize(), 0);
+  }
+
+  void test_find_checks_version() {
+    EventWorkspaceMRU mru;
+    EventList list;
+    mru.insertY(make_cow<HistogramY>(10, 1.), &list, 3);
+    TS_ASSERT(mru.findY(&list, 3));
+    TS_ASSERT(!mru.findE(&list, 3));
+    TS_ASSERT_EQUALS(mru.hits(), 1);
+    TS_ASSERT_EQUALS(mru.misses(), 1);
+    TS_ASSERT_EQUALS(mru.memorySize(), 10 * sizeof(double));
+
+    // A histogram of another version of the list is dropped
+    TS_ASSERT(!mru.findY(&list, 4));
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.memorySize(), 0);
+    TS_ASSERT_EQUALS(mru.misses(), 2);
+  }
+
+  void test_least_recently_used_are_dropped_over_budget() {
+    const size_t histogramBytes = 2 * 10 * sizeof(double);
+    // Each shard may hold three lists
+    const size_t budget =
+        3 * EventWorkspaceMRU::NUM_SHARDS * histogramBytes;
+    EventWorkspaceMRU mru(budget);
+    std::vector<EventList> lists(1000);
+    for (const auto &list : lists) {
+      mru.insertY(make_cow<HistogramY>(10, 1.), &list, 0);
+      mru.insertE(make_cow<HistogramE>(10, 1.), &list, 0);
+      TS_ASSERT_LESS_THAN_EQUALS(mru.memorySize(), budget);
+      // The first list is used all the time
+      TS_ASSERT(mru.findY(&lists.front(), 0));
+    }
+    TS_ASSERT_LESS_THAN_EQUALS(mru.MRUSize(),
+                               3 * EventWorkspaceMRU::NUM_SHARDS);
+    TS_ASSERT_EQUALS(mru.memorySize(), mru.MRUSize() * histogramBytes);
+    TS_ASSERT(mru.findY(&lists.back(), 0));
+
+    // Each shard keeps its most recently used list
+    mru.setMemoryBudget(EventWorkspaceMRU::NUM_SHARDS * histogramBytes);
+    TS_ASSERT_LESS_THAN_EQUALS(mru.MRUSize(), EventWorkspaceMRU::NUM_SHARDS);
+    TS_ASSERT(mru.findY(&lists.back(), 0));
+    mru.deleteIndex(&lists.back());
+    TS_ASSERT(!mru.findY(&lists.back(), 0));
+
+    mru.setMemoryBudget(0);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.memorySize(), 0);
+  }
+
+  void test_pins_keep_histograms_alive() {
+    EventWorkspaceMRU mru(0);
+    EventList list;
+    auto y = make_cow<HistogramY>(10, 1.);
+    mru.insertY(y, &list, 0);
+    mru.pinY(0, y);
+    TS_ASSERT_EQUALS(y.use_count(), 3);
+    for (size_t i = 0; i < EventWorkspaceMRU::PINS_PER_THREAD; ++i)
+      mru.pinY(0, make_cow<HistogramY>(10, 1.));
+    TS_ASSERT_EQUALS(y.use_count(), 2);
+    mru.clear();
+    TS_ASSERT_EQUALS(y.use_count(), 1);
   }
 };
@@ -24,6 +24,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidHistogramData/LinearGenerator.h"
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/Timer.h"
@@ -122,6 +123,11 @@ public:
     return createEventWorkspace(true, true, true);
   }
 
+  /// Let the MRU of a workspace hold this many histograms, with Y and E
+  void setMRUBudgetInHistograms(const EventWorkspace &ws, size_t count) {
+    ws.getMRU().setMemoryBudget(count * 2 * (NUMBINS - 1) * sizeof(double));
+  }
+
   void setUp() override { ew = createEventWorkspace(true, true); }
 
   void test_constructor() {
@@ -166,6 +172,24 @@ public:
     delete ew2;
   }
 
+  void test_copy_and_destroy_keep_MRUs_apart() {
+    auto copy = ew->clone();
+    TS_ASSERT_EQUALS(copy->getNumberHistograms(), NUMPIXELS);
+    TS_ASSERT_EQUALS(copy->getNumberEvents(), ew->getNumberEvents());
+    for (int i = 0; i < NUMPIXELS; ++i)
+      TS_ASSERT_EQUALS(copy->getSpectrum(i), ew->getSpectrum(i));
+
+    // Histograms are cached in the MRU of their own workspace
+    auto y = ew->sharedY(0);
+    auto yCopy = copy->sharedY(0);
+    TS_ASSERT_EQUALS(y.use_count(), 2);
+    TS_ASSERT_EQUALS(yCopy.use_count(), 2);
+    copy.reset();
+    TS_ASSERT_EQUALS(yCopy.use_count(), 1);
+    TS_ASSERT_EQUALS(y.use_count(), 2);
+    TS_ASSERT_EQUALS(ew->y(0), *y);
+  }
+
   void test_constructor_setting_default_x() {
     // Do the workspace, but don't set x explicity
     ew = createEventWorkspace(true, false);
@@ -322,6 +346,7 @@ public:
     // Try caching and most-recently-used MRU list.
     EventWorkspace_const_sptr ew2 =
         std::dynamic_pointer_cast<const EventWorkspace>(ew);
+    setMRUBudgetInHistograms(*ew2, 50);
 
     // Are the returned arrays the right size?
     MantidVec data1 = ew2->dataY(1);
@@ -347,8 +372,9 @@ public:
     data1 = ew2->dataY(0);
     TS_ASSERT_DELTA(ew2->dataY(0)[1], 2.0, 1e-6);
     TS_ASSERT_DELTA(data1[1], 2.0, 1e-6);
-    // Cache should now be full
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    // Cache should now be full, each shard holding its share of the budget
+    TS_ASSERT(ew2->MRUSize() > 0);
+    TS_ASSERT_LESS_THAN_EQUALS(ew2->MRUSize(), 50);
 
     int last = 100;
     // Read more;
@@ -356,7 +382,8 @@ public:
       data1 = ew2->dataY(i);
 
     // Cache should now be full still
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    TS_ASSERT(ew2->MRUSize() > 0);
+    TS_ASSERT_LESS_THAN_EQUALS(ew2->MRUSize(), 50);
 
     // Do it some more
     last = 200;
@@ -366,8 +393,9 @@ public:
     //----- Now we test that setAllX clears the memory ----
 
     // Yes, our eventworkspace MRU is full
-    TS_ASSERT_EQUALS(ew->MRUSize(), 50);
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    TS_ASSERT(ew->MRUSize() > 0);
+    TS_ASSERT_LESS_THAN_EQUALS(ew->MRUSize(), 50);
+    TS_ASSERT_EQUALS(ew2->MRUSize(), ew->MRUSize());
     ew->setAllX(BinEdges(10, LinearGenerator(0.0, BIN_DELTA)));
 
     // MRU should have been cleared now
@@ -532,6 +560,8 @@ public:
     EventWorkspace_const_sptr ew2 =
         std::dynamic_pointer_cast<const EventWorkspace>(ew);
 
+    setMRUBudgetInHistograms(*ew2, 50);
+
     // OK, we grab data0 from the MRU.
     const auto &inSpec = ew2->getSpectrum(0);
     const auto &inSpec300 = ew2->getSpectrum(300);
@@ -549,7 +579,8 @@ public:
     TS_ASSERT_DIFFERS(&e300, &inSpec.readE());
 
     // MRU is full
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    TS_ASSERT(ew2->MRUSize() > 0);
+    TS_ASSERT_LESS_THAN_EQUALS(ew2->MRUSize(), 50);
   }
 
   void test_sortAll_TOF() {
@@ -567,6 +598,24 @@ public:
     }
   }
 
+  void test_packColumns() {
+    EventWorkspace_sptr ws =
+        WorkspaceCreationHelper::createRandomEventWorkspace(NUMBINS, NUMPIXELS);
+    auto reference = ws->clone();
+    ws->packColumns();
+    for (int wi = 0; wi < NUMPIXELS; wi++) {
+      TS_ASSERT(ws->getSpectrum(wi).hasColumns());
+      TS_ASSERT_EQUALS(ws->readY(wi), reference->readY(wi));
+    }
+    ws->sortAll(TOF_SORT, nullptr);
+    reference->sortAll(TOF_SORT, nullptr);
+    for (int wi = 0; wi < NUMPIXELS; wi++) {
+      TS_ASSERT(ws->getSpectrum(wi).hasColumns());
+      TS_ASSERT_EQUALS(ws->getSpectrum(wi).getEvents(),
+                       reference->getSpectrum(wi).getEvents());
+    }
+  }
+
   /** Test sortAll() when there are more cores available than pixels.
    * This test will only work on machines with 2 cores at least.
    */
@@ -842,4 +891,52 @@ public:
     // Placement-new to put ws back into valid state (avoid double-destruct)
     static_cast<void>(new (memory) EventList());
   }
+
+  void test_changing_events_invalidates_cached_histogram() {
+    auto ws = WorkspaceCreationHelper::createRandomEventWorkspace(2, 1);
+    const double counts = ws->y(0)[0];
+    TS_ASSERT_EQUALS(ws->getMRU().misses(), 1);
+    TS_ASSERT_EQUALS(ws->y(0)[0], counts);
+    TS_ASSERT_EQUALS(ws->getMRU().hits(), 1);
+
+    // No need to clear the MRU after changing the events
+    ws->getSpectrum(0) += TofEvent(ws->x(0)[0]);
+    TS_ASSERT_EQUALS(ws->y(0)[0], counts + 1.);
+    ws->getSpectrum(0).getEvents().clear();
+    TS_ASSERT_EQUALS(ws->y(0)[0], 0.);
+    TS_ASSERT_EQUALS(ws->getMRU().hits(), 1);
+    TS_ASSERT_EQUALS(ws->MRUSize(), 1);
+  }
+
+  void test_adding_events_quickly_invalidates_cached_histogram() {
+    auto ws = WorkspaceCreationHelper::createRandomEventWorkspace(2, 1);
+    const double counts = ws->y(0)[0];
+    ws->getSpectrum(0).addEventQuickly(TofEvent(ws->x(0)[0]));
+    TS_ASSERT_EQUALS(ws->y(0)[0], counts + 1.);
+
+    auto &weighted = ws->getSpectrum(0);
+    weighted.switchTo(WEIGHTED);
+    TS_ASSERT_EQUALS(ws->y(0)[0], counts + 1.);
+    weighted.addEventQuickly(WeightedEvent(ws->x(0)[0], 0, 2., 4.));
+    TS_ASSERT_EQUALS(ws->y(0)[0], counts + 3.);
+
+    weighted.switchTo(WEIGHTED_NOTIME);
+    TS_ASSERT_EQUALS(ws->y(0)[0], counts + 3.);
+    weighted.addEventQuickly(WeightedEventNoTime(ws->x(0)[0], 3., 9.));
+    TS_ASSERT_EQUALS(ws->y(0)[0], counts + 6.);
+  }
+
+  void test_references_outlive_eviction_from_MRU() {
+    auto ws = WorkspaceCreationHelper::createRandomEventWorkspace(10, 10);
+    ws->getMRU().setMemoryBudget(0);
+    const auto &y0 = ws->y(0);
+    const auto expected = y0.rawData();
+    for (size_t i = 1; i < ws->getNumberHistograms(); ++i)
+      ws->y(i);
+    // Each shard only keeps the last histogram read in it, but y0 is pinned
+    TS_ASSERT_LESS_THAN_EQUALS(ws->MRUSize(), EventWorkspaceMRU::NUM_SHARDS);
+    TS_ASSERT_EQUALS(ws->getMRU().memorySize(),
+                     ws->MRUSize() * 2 * 9 * sizeof(double));
+    TS_ASSERT_EQUALS(y0.rawData(), expected);
+  }
 };
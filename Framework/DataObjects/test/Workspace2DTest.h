@@ -80,6 +80,24 @@ public:
     }
   }
 
+  void test_spectra_are_held_in_one_vector() {
+    Workspace2D ws2D;
+    ws2D.initialize(3, 4, 3);
+    TS_ASSERT_EQUALS(&ws2D.getSpectrum(1), &ws2D.getSpectrum(0) + 1);
+    TS_ASSERT_EQUALS(&ws2D.getSpectrum(2), &ws2D.getSpectrum(0) + 2);
+    TS_ASSERT_EQUALS(ws2D.getSpectrum(2).getSpectrumNo(), 3);
+
+    // A copy holds its own spectra, which are independent of the original
+    auto copy = ws2D.clone();
+    TS_ASSERT_EQUALS(&copy->getSpectrum(1), &copy->getSpectrum(0) + 1);
+    TS_ASSERT_DIFFERS(&copy->getSpectrum(0), &ws2D.getSpectrum(0));
+    copy->getSpectrum(1).setSpectrumNo(7);
+    copy->mutableY(1)[0] = 2.;
+    TS_ASSERT_EQUALS(ws2D.getSpectrum(1).getSpectrumNo(), 2);
+    TS_ASSERT_EQUALS(ws2D.y(1)[0], 0.);
+    TS_ASSERT_EQUALS(copy->y(1)[0], 2.);
+  }
+
   void testUnequalBins() {
     // try normal kind first
     TS_ASSERT_EQUALS(ws->blocksize(), 5);
@@ -6,13 +6,50 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidHistogramData/BinEdges.h"
 #include "MantidHistogramData/DllConfig.h"
+#include "MantidHistogramData/HistogramX.h"
+#include "MantidKernel/cow_ptr.h"
+
+#include <vector>
+
 namespace Mantid {
 namespace HistogramData {
 class Histogram;
-class BinEdges;
 
 MANTID_HISTOGRAMDATA_DLL Histogram rebin(const Histogram &input,
                                          const BinEdges &binEdges);
+
+/** RebinPlan : the overlaps of the bins of a histogram with a set of new bin
+  edges, found once and then used to rebin every histogram sharing the same X,
+  such as the spectra of a workspace created with common bin edges.
+ */
+class MANTID_HISTOGRAMDATA_DLL RebinPlan {
+public:
+  RebinPlan(const Histogram &input, const BinEdges &binEdges);
+
+  /// True if the plan can rebin the histogram, i.e. it shares its X
+  bool appliesTo(const Histogram &input) const;
+
+  friend MANTID_HISTOGRAMDATA_DLL Histogram rebin(const Histogram &input,
+                                                  const RebinPlan &plan);
+
+private:
+  /// X of the histograms the plan applies to
+  Kernel::cow_ptr<HistogramX> m_x;
+  /// The new bin edges
+  BinEdges m_binEdges;
+  /// Old bin of each overlap
+  std::vector<size_t> m_oldBins;
+  /// New bin of each overlap
+  std::vector<size_t> m_newBins;
+  /// Width of each overlap
+  std::vector<double> m_widths;
+  /// Width of the old bin of each overlap
+  std::vector<double> m_oldWidths;
+};
+
+MANTID_HISTOGRAMDATA_DLL Histogram rebin(const Histogram &input,
+                                         const RebinPlan &plan);
 } // namespace HistogramData
 } // namespace Mantid
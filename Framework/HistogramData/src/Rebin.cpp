@@ -21,19 +21,16 @@ using Mantid::HistogramData::Histogram;
 using Mantid::HistogramData::Exception::InvalidBinEdgesError;
 
 namespace {
-Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
-  auto &xold = input.x();
-  auto &yold = input.y();
-  auto &eold = input.e();
-
-  auto &xnew = binEdges.rawData();
-  Counts newCounts(xnew.size() - 1);
-  CountVariances newCountVariances(xnew.size() - 1);
-  auto &ynew = newCounts.mutableData();
-  auto &enew = newCountVariances.mutableData();
-
-  auto size_yold = yold.size();
-  auto size_ynew = ynew.size();
+/** Call overlap(iold, inew, delta, owidth) for each pair of old and new bins
+ * that overlap, where delta is the width of the overlap and owidth the width
+ * of the old bin.
+ * @throws InvalidBinEdgesError for non-positive input/output bin widths
+ */
+template <typename OVERLAP>
+void forEachOverlap(const std::vector<double> &xold,
+                    const std::vector<double> &xnew, OVERLAP overlap) {
+  auto size_yold = xold.size() - 1;
+  auto size_ynew = xnew.size() - 1;
   size_t iold = 0;
   size_t inew = 0;
 
@@ -66,8 +63,7 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
       auto delta = xo_high < xn_high ? xo_high : xn_high;
       delta -= xo_low > xn_low ? xo_low : xn_low;
 
-      ynew[inew] += yold[iold] * delta / owidth;
-      enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+      overlap(iold, inew, delta, owidth);
 
       if (xn_high > xo_high) {
         iold++;
@@ -76,65 +72,58 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
       }
     }
   }
-
-  return Histogram(binEdges, newCounts,
-                   CountStandardDeviations(std::move(newCountVariances)));
 }
 
-Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
-  auto &xold = input.x();
+Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
   auto &yold = input.y();
   auto &eold = input.e();
 
   auto &xnew = binEdges.rawData();
-  Frequencies newFrequencies(xnew.size() - 1);
-  FrequencyStandardDeviations newFrequencyStdDev(xnew.size() - 1);
-  auto &ynew = newFrequencies.mutableData();
-  auto &enew = newFrequencyStdDev.mutableData();
-
-  auto size_yold = yold.size();
-  auto size_ynew = ynew.size();
-  size_t iold = 0;
-  size_t inew = 0;
-
-  while ((inew < size_ynew) && (iold < size_yold)) {
-    auto xo_low = xold[iold];
-    auto xo_high = xold[iold + 1];
-    auto xn_low = xnew[inew];
-    auto xn_high = xnew[inew + 1];
-
-    auto owidth = xo_high - xo_low;
-    auto nwidth = xn_high - xn_low;
-
-    if (owidth <= 0.0 || nwidth <= 0.0)
-      throw InvalidBinEdgesError("Negative or zero bin widths not allowed.");
-
-    if (xn_high <= xo_low)
-      inew++; /* old and new bins do not overlap */
-    else if (xo_high <= xn_low)
-      iold++; /* old and new bins do not overlap */
-    else {
-      //        delta is the overlap of the bins on the x axis
-      auto delta = xo_high < xn_high ? xo_high : xn_high;
-      delta -= xo_low > xn_low ? xo_low : xn_low;
+  Counts newCounts(xnew.size() - 1);
+  CountVariances newCountVariances(xnew.size() - 1);
+  auto &ynew = newCounts.mutableData();
+  auto &enew = newCountVariances.mutableData();
 
-      ynew[inew] += yold[iold] * delta;
-      enew[inew] += eold[iold] * eold[iold] * delta * owidth;
+  forEachOverlap(input.x().rawData(), xnew,
+                 [&](const size_t iold, const size_t inew, const double delta,
+                     const double owidth) {
+                   ynew[inew] += yold[iold] * delta / owidth;
+                   enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+                 });
 
-      if (xn_high > xo_high) {
-        iold++;
-      } else {
-        inew++;
-      }
-    }
-  }
+  return Histogram(binEdges, newCounts,
+                   CountStandardDeviations(std::move(newCountVariances)));
+}
 
-  for (size_t i = 0; i < size_ynew; ++i) {
+/// Turn the summed frequencies and variances times widths into frequencies
+void normaliseFrequencies(const std::vector<double> &xnew,
+                          std::vector<double> &ynew,
+                          std::vector<double> &enew) {
+  for (size_t i = 0; i < ynew.size(); ++i) {
     auto width = xnew[i + 1] - xnew[i];
     auto factor = 1 / width;
     ynew[i] *= factor;
     enew[i] = sqrt(enew[i]) * factor;
   }
+}
+
+Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
+  auto &yold = input.y();
+  auto &eold = input.e();
+
+  auto &xnew = binEdges.rawData();
+  Frequencies newFrequencies(xnew.size() - 1);
+  FrequencyStandardDeviations newFrequencyStdDev(xnew.size() - 1);
+  auto &ynew = newFrequencies.mutableRawData();
+  auto &enew = newFrequencyStdDev.mutableRawData();
+
+  forEachOverlap(input.x().rawData(), xnew,
+                 [&](const size_t iold, const size_t inew, const double delta,
+                     const double owidth) {
+                   ynew[inew] += yold[iold] * delta;
+                   enew[inew] += eold[iold] * eold[iold] * delta * owidth;
+                 });
+  normaliseFrequencies(xnew, ynew, enew);
 
   return Histogram(binEdges, newFrequencies, newFrequencyStdDev);
 }
@@ -162,5 +151,81 @@ Histogram rebin(const Histogram &input, const BinEdges &binEdges) {
     throw std::runtime_error("YMode must be defined for input histogram.");
 }
 
+/** Find the overlaps of the bins of a histogram with a set of new bin edges.
+ * @param input :: histogram whose X the plan applies to.
+ * @param binEdges :: the histograms will be rebinned according to this set of
+ * bin edges.
+ * @throws std::runtime_error if the input histogram xmode is not BinEdges
+ * @throws InvalidBinEdgesError for non-positive input/output bin widths
+ */
+RebinPlan::RebinPlan(const Histogram &input, const BinEdges &binEdges)
+    : m_x(input.sharedX()), m_binEdges(binEdges) {
+  if (input.xMode() != Histogram::XMode::BinEdges)
+    throw std::runtime_error(
+        "XMode must be Histogram::XMode::BinEdges for input histogram");
+  forEachOverlap(input.x().rawData(), binEdges.rawData(),
+                 [this](const size_t iold, const size_t inew,
+                        const double delta, const double owidth) {
+                   m_oldBins.emplace_back(iold);
+                   m_newBins.emplace_back(inew);
+                   m_widths.emplace_back(delta);
+                   m_oldWidths.emplace_back(owidth);
+                 });
+}
+
+bool RebinPlan::appliesTo(const Histogram &input) const {
+  return input.sharedX() == m_x;
+}
+
+/** Rebins data with the overlaps of a plan, without searching for them again.
+ * @param input :: input histogram data to be rebinned. It must share the X of
+ * the histogram the plan was made for.
+ * @param plan :: the overlaps of the input bins with the new bin edges.
+ * @returns The rebinned histogram.
+ * @throws std::runtime_error if the plan does not apply to the input, or the
+ * input yMode is undefined
+ */
+Histogram rebin(const Histogram &input, const RebinPlan &plan) {
+  if (!plan.appliesTo(input))
+    throw std::runtime_error("The rebin plan is for another X.");
+
+  const auto &yold = input.y().rawData();
+  const auto &eold = input.e().rawData();
+  const auto &xnew = plan.m_binEdges.rawData();
+  const size_t numOverlaps = plan.m_oldBins.size();
+  if (input.yMode() == Histogram::YMode::Counts) {
+    Counts newCounts(xnew.size() - 1);
+    CountVariances newCountVariances(xnew.size() - 1);
+    auto &ynew = newCounts.mutableRawData();
+    auto &enew = newCountVariances.mutableRawData();
+    for (size_t i = 0; i < numOverlaps; ++i) {
+      const auto iold = plan.m_oldBins[i];
+      const auto inew = plan.m_newBins[i];
+      const double delta = plan.m_widths[i];
+      const double owidth = plan.m_oldWidths[i];
+      ynew[inew] += yold[iold] * delta / owidth;
+      enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+    }
+    return Histogram(plan.m_binEdges, newCounts,
+                     CountStandardDeviations(std::move(newCountVariances)));
+  } else if (input.yMode() == Histogram::YMode::Frequencies) {
+    Frequencies newFrequencies(xnew.size() - 1);
+    FrequencyStandardDeviations newFrequencyStdDev(xnew.size() - 1);
+    auto &ynew = newFrequencies.mutableRawData();
+    auto &enew = newFrequencyStdDev.mutableRawData();
+    for (size_t i = 0; i < numOverlaps; ++i) {
+      const auto iold = plan.m_oldBins[i];
+      const auto inew = plan.m_newBins[i];
+      const double delta = plan.m_widths[i];
+      const double owidth = plan.m_oldWidths[i];
+      ynew[inew] += yold[iold] * delta;
+      enew[inew] += eold[iold] * eold[iold] * delta * owidth;
+    }
+    normaliseFrequencies(xnew, ynew, enew);
+    return Histogram(plan.m_binEdges, newFrequencies, newFrequencyStdDev);
+  } else
+    throw std::runtime_error("YMode must be defined for input histogram.");
+}
+
 } // namespace HistogramData
 } // namespace Mantid
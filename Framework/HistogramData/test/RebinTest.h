@@ -388,6 +388,48 @@ public:
     TS_ASSERT_EQUALS(outFreq.e()[2], 0);
   }
 
+  void testRebinPlanMatchesRebin() {
+    BinEdges edges{0.5, 1.25, 2, 4.5, 5, 8.75, 9.5};
+    for (const auto &hist : {getCountsHistogram(), getFrequencyHistogram()}) {
+      RebinPlan plan(hist, edges);
+      // Another histogram sharing the same X
+      auto other = hist;
+      other.mutableY() *= 2.;
+      for (const auto &input : {hist, other}) {
+        TS_ASSERT(plan.appliesTo(input));
+        auto expected = rebin(input, edges);
+        auto output = rebin(input, plan);
+        TS_ASSERT_EQUALS(output.yMode(), expected.yMode());
+        TS_ASSERT_EQUALS(output.x(), expected.x());
+        for (size_t i = 0; i < expected.size(); ++i) {
+          TS_ASSERT_EQUALS(output.y()[i], expected.y()[i]);
+          TS_ASSERT_EQUALS(output.e()[i], expected.e()[i]);
+        }
+      }
+    }
+  }
+
+  void testRebinPlanDoesNotApplyToOtherX() {
+    auto hist = getCountsHistogram();
+    RebinPlan plan(hist, BinEdges(5, LinearGenerator(0, 2)));
+    // Equal values, but not shared
+    auto other = getCountsHistogram();
+    TS_ASSERT(!plan.appliesTo(other));
+    TS_ASSERT_THROWS(rebin(other, plan), const std::runtime_error &);
+  }
+
+  void testRebinPlanFailsBinEdgesInvalid() {
+    std::vector<double> binEdges{1, 2, 3, 3, 5, 7};
+    BinEdges edges(binEdges);
+    TS_ASSERT_THROWS(RebinPlan(getCountsHistogram(), edges),
+                     const InvalidBinEdgesError &);
+    TS_ASSERT_THROWS(
+        RebinPlan(Histogram(Points(5, LinearGenerator(0, 1)),
+                            Counts{10, 1, 3, 4, 7}),
+                  edges),
+        const std::runtime_error &);
+  }
+
 private:
   Histogram getCountsHistogram() {
     return Histogram(BinEdges(10, LinearGenerator(0, 1)),
@@ -443,6 +485,18 @@ public:
       rebin(histFreq, lgBins);
   }
 
+  void testRebinCountsSmallerBinsWithPlan() {
+    RebinPlan plan(hist, smBins);
+    for (size_t i = 0; i < nIters; i++)
+      rebin(hist, plan);
+  }
+
+  void testRebinCountsLargerBinsWithPlan() {
+    RebinPlan plan(hist, lgBins);
+    for (size_t i = 0; i < nIters; i++)
+      rebin(hist, plan);
+  }
+
 private:
   const size_t binSize = 10000;
   const size_t nIters = 10000;
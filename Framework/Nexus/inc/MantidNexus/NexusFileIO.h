@@ -18,6 +18,7 @@
 
 #include <boost/optional.hpp>
 #include <climits>
+#include <functional>
 #include <memory>
 #include <nexus/NeXusFile.hpp>
 
@@ -77,16 +78,23 @@ public:
   int writeNexusProcessedDataEvent(
       const DataObjects::EventWorkspace_const_sptr &ws);
 
+  /// Fill the fields of the events from start to start + count
+  using EventBlockFiller =
+      std::function<void(int64_t start, int64_t count, double *tofs,
+                         float *weights, float *errorSquareds,
+                         int64_t *pulsetimes)>;
+
   int writeNexusProcessedDataEventCombined(
       const DataObjects::EventWorkspace_const_sptr &ws,
-      std::vector<int64_t> &indices, double *tofs, float *weights,
-      float *errorSquareds, int64_t *pulsetimes, bool compress) const;
+      const std::vector<int64_t> &indices, bool writeTOF, bool writePulsetime,
+      bool writeWeight, bool writeError, int compressionLevel,
+      int64_t chunkSize, const EventBlockFiller &fill) const;
 
   int writeEventList(const DataObjects::EventList &el,
                      const std::string &group_name) const;
 
   template <class T>
-  void writeEventListData(std::vector<T> events, bool writeTOF,
+  void writeEventListData(const std::vector<T> &events, bool writeTOF,
                           bool writePulsetime, bool writeWeight,
                           bool writeError) const;
   void NXwritedata(const char *name, int datatype, int rank, int *dims_array,
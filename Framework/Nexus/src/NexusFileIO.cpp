@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 // NexusFileIO
 // @author Ronald Fowler
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -40,6 +41,23 @@ using namespace DataObjects;
 namespace {
 /// static logger
 Logger g_log("NexusFileIO");
+
+/// Number of chunks of the combined event fields written at once
+constexpr int64_t CHUNKS_PER_BLOCK = 16;
+
+/** Make a one-dimensional data field in the open group, compressed in chunks
+ * of the given size unless compression is NX_COMP_NONE. */
+void makeData64(NXhandle fileID, const char *name, int datatype, int64_t size,
+                int compression, int64_t chunkSize) {
+  int64_t dims_array[1] = {size};
+  if (compression != NX_COMP_NONE && size > 0) {
+    int64_t chunk_array[1] = {std::min(chunkSize, size)};
+    NXcompmakedata64(fileID, name, datatype, 1, dims_array, compression,
+                     chunk_array);
+  } else {
+    NXmakedata64(fileID, name, datatype, 1, dims_array);
+  }
+}
 } // namespace
 
 /// Empty default constructor
@@ -449,7 +467,8 @@ int NexusFileIO::writeNexusProcessedData2D(
     start[0] = 0;
     asize[1] = dims_array[1];
     for (size_t i = 0; i < nSpect; i++) {
-      NXputslab(fileID, localworkspace->x(i).rawData().data(), start, asize);
+      NXputslab(fileID, localworkspace->x(spec[i]).rawData().data(), start,
+                asize);
       start[0]++;
     }
   }
@@ -735,30 +754,40 @@ int NexusFileIO::writeNexusTableWorkspace(
 }
 
 //-------------------------------------------------------------------------------------
-/** Write out a combined chunk of event data
+/** Write out the events of all the event lists of a workspace, combined in one
+ * array for each field. The arrays are written a block of CHUNKS_PER_BLOCK
+ * chunks at a time, each block being filled by a callback, so that only one
+ * block of events is held in memory on top of the workspace.
  *
  * @param ws :: an EventWorkspace
- * @param indices :: array of event list indexes
- * @param tofs :: array of TOFs
- * @param weights :: array of event weights
- * @param errorSquareds :: array of event squared errors
- * @param pulsetimes :: array of pulsetimes
- * @param compress :: if true, compress the entry
+ * @param indices :: index of the first event of each event list, followed by
+ *        the total number of events
+ * @param writeTOF :: if true, write the TOFs
+ * @param writePulsetime :: if true, write the pulse times
+ * @param writeWeight :: if true, write the weights
+ * @param writeError :: if true, write the errors
+ * @param compressionLevel :: deflate level of the fields, from 1 (fastest) to
+ *        9 (smallest files); 0 not to compress them
+ * @param chunkSize :: number of events in each chunk of a compressed field
+ * @param fill :: callback filling the fields of a block of events
  */
 int NexusFileIO::writeNexusProcessedDataEventCombined(
     const DataObjects::EventWorkspace_const_sptr &ws,
-    std::vector<int64_t> &indices, double *tofs, float *weights,
-    float *errorSquareds, int64_t *pulsetimes, bool compress) const {
+    const std::vector<int64_t> &indices, bool writeTOF, bool writePulsetime,
+    bool writeWeight, bool writeError, int compressionLevel, int64_t chunkSize,
+    const EventBlockFiller &fill) const {
   NXopengroup(fileID, "event_workspace", "NXdata");
 
+  const int compression =
+      compressionLevel > 0 && m_nexuscompression != NX_COMP_NONE
+          ? NX_COMP_LZW_LVL0 + std::min(compressionLevel, 9)
+          : NX_COMP_NONE;
+  chunkSize = std::max(int64_t(1), chunkSize);
+
   // The array of indices for each event list #
-  int dims_array[1] = {static_cast<int>(indices.size())};
   if (!indices.empty()) {
-    if (compress)
-      NXcompmakedata(fileID, "indices", NX_INT64, 1, dims_array,
-                     m_nexuscompression, dims_array);
-    else
-      NXmakedata(fileID, "indices", NX_INT64, 1, dims_array);
+    makeData64(fileID, "indices", NX_INT64,
+               static_cast<int64_t>(indices.size()), compression, chunkSize);
     NXopendata(fileID, "indices");
     NXputdata(fileID, indices.data());
     std::string yUnits = ws->YUnit();
@@ -770,21 +799,60 @@ int NexusFileIO::writeNexusProcessedDataEventCombined(
     NXclosedata(fileID);
   }
 
-  // Write out each field
-  dims_array[0] = static_cast<int>(
-      indices.back()); // TODO big truncation error! This is the # of events
-  if (tofs)
-    NXwritedata("tof", NX_FLOAT64, 1, dims_array, tofs, compress);
-  if (pulsetimes)
-    NXwritedata("pulsetime", NX_INT64, 1, dims_array, pulsetimes, compress);
-  if (weights)
-    NXwritedata("weight", NX_FLOAT32, 1, dims_array, weights, compress);
-  if (errorSquareds)
-    NXwritedata("error_squared", NX_FLOAT32, 1, dims_array, errorSquareds,
-                compress);
+  // Make each field, with the total number of events
+  const int64_t numEvents = indices.empty() ? 0 : indices.back();
+  if (writeTOF)
+    makeData64(fileID, "tof", NX_FLOAT64, numEvents, compression, chunkSize);
+  if (writePulsetime)
+    makeData64(fileID, "pulsetime", NX_INT64, numEvents, compression,
+               chunkSize);
+  if (writeWeight)
+    makeData64(fileID, "weight", NX_FLOAT32, numEvents, compression,
+               chunkSize);
+  if (writeError)
+    makeData64(fileID, "error_squared", NX_FLOAT32, numEvents, compression,
+               chunkSize);
+
+  // Then fill and write them a block at a time. A block is made of whole
+  // chunks, so that no compressed chunk is written twice.
+  const int64_t blockSize = std::min(numEvents, chunkSize * CHUNKS_PER_BLOCK);
+  std::vector<double> tofs(writeTOF ? blockSize : 0);
+  std::vector<int64_t> pulsetimes(writePulsetime ? blockSize : 0);
+  std::vector<float> weights(writeWeight ? blockSize : 0);
+  std::vector<float> errorSquareds(writeError ? blockSize : 0);
+  NXstatus status = NX_OK;
+  for (int64_t start = 0; start < numEvents && status != NX_ERROR;
+       start += blockSize) {
+    const int64_t count = std::min(blockSize, numEvents - start);
+    fill(start, count, writeTOF ? tofs.data() : nullptr,
+         writeWeight ? weights.data() : nullptr,
+         writeError ? errorSquareds.data() : nullptr,
+         writePulsetime ? pulsetimes.data() : nullptr);
+
+    const int64_t slabStart[1] = {start};
+    const int64_t slabSize[1] = {count};
+    const auto putSlab = [&](const char *name, const void *data) {
+      if (status == NX_ERROR)
+        return;
+      status = NXopendata(fileID, name);
+      if (status != NX_ERROR) {
+        status = NXputslab64(fileID, data, slabStart, slabSize);
+        NXclosedata(fileID);
+      }
+    };
+    if (writeTOF)
+      putSlab("tof", tofs.data());
+    if (writePulsetime)
+      putSlab("pulsetime", pulsetimes.data());
+    if (writeWeight)
+      putSlab("weight", weights.data());
+    if (writeError)
+      putSlab("error_squared", errorSquareds.data());
+  }
 
   // Close up the overall group
-  NXstatus status = NXclosegroup(fileID);
+  if (NXclosegroup(fileID) == NX_ERROR)
+    status = NX_ERROR;
   return ((status == NX_ERROR) ? 3 : 0);
 }
 
@@ -838,31 +906,30 @@ void NexusFileIO::NXwritedata(const char *name, int datatype, int rank,
  * @param writeError :: if true, write the errors
  */
 template <class T>
-void NexusFileIO::writeEventListData(std::vector<T> events, bool writeTOF,
-                                     bool writePulsetime, bool writeWeight,
-                                     bool writeError) const {
+void NexusFileIO::writeEventListData(const std::vector<T> &events,
+                                     bool writeTOF, bool writePulsetime,
+                                     bool writeWeight, bool writeError) const {
   // Do nothing if there are no events.
   if (events.empty())
     return;
 
   size_t num = events.size();
-  auto tofs = new double[num];
-  auto weights = new double[num];
-  auto errorSquareds = new double[num];
-  auto pulsetimes = new int64_t[num];
-
-  size_t i = 0;
-  // Fill the C-arrays with the fields from all the events, as requested.
-  for (auto it = events.cbegin(); it != events.cend(); ++it) {
+  std::vector<double> tofs(writeTOF ? num : 0);
+  std::vector<float> weights(writeWeight ? num : 0);
+  std::vector<float> errorSquareds(writeError ? num : 0);
+  std::vector<int64_t> pulsetimes(writePulsetime ? num : 0);
+
+  // Fill the arrays with the fields from all the events, as requested.
+  for (size_t i = 0; i < num; ++i) {
+    const auto &event = events[i];
     if (writeTOF)
-      tofs[i] = it->tof();
+      tofs[i] = event.tof();
     if (writePulsetime)
-      pulsetimes[i] = it->pulseTime().totalNanoseconds();
+      pulsetimes[i] = event.pulseTime().totalNanoseconds();
     if (writeWeight)
-      weights[i] = it->weight();
+      weights[i] = static_cast<float>(event.weight());
     if (writeError)
-      errorSquareds[i] = it->errorSquared();
-    ++i;
+      errorSquareds[i] = static_cast<float>(event.errorSquared());
   }
 
   // Write out all the required arrays.
@@ -871,20 +938,16 @@ void NexusFileIO::writeEventListData(std::vector<T> events, bool writeTOF,
   // managed event workspaces.
   bool compress = true; //(num > 100);
   if (writeTOF)
-    NXwritedata("tof", NX_FLOAT64, 1, dims_array, tofs, compress);
+    NXwritedata("tof", NX_FLOAT64, 1, dims_array, tofs.data(), compress);
   if (writePulsetime)
-    NXwritedata("pulsetime", NX_INT64, 1, dims_array, pulsetimes, compress);
+    NXwritedata("pulsetime", NX_INT64, 1, dims_array, pulsetimes.data(),
+                compress);
   if (writeWeight)
-    NXwritedata("weight", NX_FLOAT32, 1, dims_array, weights, compress);
-  if (writeError)
-    NXwritedata("error_squared", NX_FLOAT32, 1, dims_array, errorSquareds,
+    NXwritedata("weight", NX_FLOAT32, 1, dims_array, weights.data(),
                 compress);
-
-  // Free mem.
-  delete[] tofs;
-  delete[] weights;
-  delete[] errorSquareds;
-  delete[] pulsetimes;
+  if (writeError)
+    NXwritedata("error_squared", NX_FLOAT32, 1, dims_array,
+                errorSquareds.data(), compress);
 }
 
 //-------------------------------------------------------------------------------------
@@ -905,8 +968,8 @@ int NexusFileIO::writeEventList(const DataObjects::EventList &el,
 
   // Write out the detector IDs
   if (!dets.empty()) {
-    std::vector<detid_t> detectorIDs(dets.begin(), dets.end());
-    int dims_array[1];
+    std::vector<int64_t> detectorIDs(dets.begin(), dets.end());
+    int dims_array[1] = {static_cast<int>(detectorIDs.size())};
     NXwritedata("detector_IDs", NX_INT64, 1, dims_array, detectorIDs.data(),
                 false);
   }
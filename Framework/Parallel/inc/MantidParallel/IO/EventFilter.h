@@ -0,0 +1,39 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidTypes/Event/TofEvent.h"
+
+#include <cstdint>
+#include <limits>
+
+namespace Mantid {
+namespace Parallel {
+namespace IO {
+
+/** EventFilter : limits of the events to load, in time-of-flight and in pulse
+  time. The limits are included, as in LoadEventNexus. By default all events
+  are accepted.
+*/
+struct EventFilter {
+  double tofMin{std::numeric_limits<double>::lowest()};
+  double tofMax{std::numeric_limits<double>::max()};
+  /// Pulse time limits, in nanoseconds since the Mantid epoch
+  int64_t pulseTimeMin{std::numeric_limits<int64_t>::min()};
+  int64_t pulseTimeMax{std::numeric_limits<int64_t>::max()};
+
+  /// Return true if the event is inside the limits
+  bool accepts(const Types::Event::TofEvent &event) const {
+    const auto pulseTime = event.pulseTime().totalNanoseconds();
+    return event.tof() >= tofMin && event.tof() <= tofMax &&
+           pulseTime >= pulseTimeMin && pulseTime <= pulseTimeMax;
+  }
+};
+
+} // namespace IO
+} // namespace Parallel
+} // namespace Mantid
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "MantidParallel/DllConfig.h"
+#include "MantidParallel/IO/EventFilter.h"
 
 namespace Mantid {
 namespace Types {
@@ -44,7 +45,7 @@ load(const std::string &filename, const std::string &groupName,
      const std::vector<std::string> &bankNames,
      const std::vector<int32_t> &bankOffsets,
      const std::vector<std::vector<Types::Event::TofEvent> *> &eventLists,
-     bool precalcEvents);
+     bool precalcEvents, const EventFilter &filter = EventFilter());
 
 } // namespace EventLoader
 
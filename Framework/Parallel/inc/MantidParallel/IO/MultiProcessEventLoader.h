@@ -15,6 +15,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "MantidParallel/IO/EventFilter.h"
 #include "MantidParallel/IO/EventLoaderHelpers.h"
 #include "MantidParallel/IO/EventsListsShmemStorage.h"
 
@@ -41,6 +42,10 @@ namespace IO {
  *
  * There 3 main time consuming parts: reading from file, pushing to shared
  * memory, collecting from shared memory, the cost of sorting is small.
+ *
+ * Events outside the limits of the EventFilter are dropped by the child
+ * processes, before they reach shared memory. Event lists that are NULL in the
+ * result are not collected.
 
   @author Igor Gudich
   @date 2018
@@ -54,14 +59,16 @@ public:
   load(const std::string &filename, const std::string &groupname,
        const std::vector<std::string> &bankNames,
        const std::vector<int32_t> &bankOffsets,
-       std::vector<std::vector<Types::Event::TofEvent> *> eventLists) const;
+       std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+       const EventFilter &filter = EventFilter()) const;
 
   static void fillFromFile(EventsListsShmemStorage &storage,
                            const std::string &filename,
                            const std::string &groupname,
                            const std::vector<std::string> &bankNames,
                            const std::vector<int32_t> &bankOffsets,
-                           std::size_t from, std::size_t to, bool precalc);
+                           std::size_t from, std::size_t to, bool precalc,
+                           const EventFilter &filter = EventFilter());
 
   enum struct LoadType { preCalcEvents, producerConsumer };
 
@@ -78,14 +85,16 @@ private:
                               const H5::Group &group,
                               const std::vector<std::string> &bankNames,
                               const std::vector<int32_t> &bankOffsets,
-                              std::size_t from, std::size_t to);
+                              std::size_t from, std::size_t to,
+                              const EventFilter &filter);
 
     static void loadFromGroupWrapper(const H5::DataType &type,
                                      EventsListsShmemStorage &storage,
                                      const H5::Group &group,
                                      const std::vector<std::string> &bankNames,
                                      const std::vector<int32_t> &bankOffsets,
-                                     std::size_t from, std::size_t to);
+                                     std::size_t from, std::size_t to,
+                                     const EventFilter &filter);
   };
 
   void assembleFromShared(
@@ -108,25 +117,26 @@ template <typename MultiProcessEventLoader::LoadType LT>
 void MultiProcessEventLoader::GroupLoader<LT>::loadFromGroupWrapper(
     const H5::DataType &type, EventsListsShmemStorage &storage,
     const H5::Group &instrument, const std::vector<std::string> &bankNames,
-    const std::vector<int32_t> &bankOffsets, std::size_t from, std::size_t to) {
+    const std::vector<int32_t> &bankOffsets, std::size_t from, std::size_t to,
+    const EventFilter &filter) {
   if (type == H5::PredType::NATIVE_INT32)
     return loadFromGroup<int32_t>(storage, instrument, bankNames, bankOffsets,
-                                  from, to);
+                                  from, to, filter);
   if (type == H5::PredType::NATIVE_INT64)
     return loadFromGroup<int64_t>(storage, instrument, bankNames, bankOffsets,
-                                  from, to);
+                                  from, to, filter);
   if (type == H5::PredType::NATIVE_UINT32)
     return loadFromGroup<uint32_t>(storage, instrument, bankNames, bankOffsets,
-                                   from, to);
+                                   from, to, filter);
   if (type == H5::PredType::NATIVE_UINT64)
     return loadFromGroup<uint64_t>(storage, instrument, bankNames, bankOffsets,
-                                   from, to);
+                                   from, to, filter);
   if (type == H5::PredType::NATIVE_FLOAT)
     return loadFromGroup<float>(storage, instrument, bankNames, bankOffsets,
-                                from, to);
+                                from, to, filter);
   if (type == H5::PredType::NATIVE_DOUBLE)
     return loadFromGroup<double>(storage, instrument, bankNames, bankOffsets,
-                                 from, to);
+                                 from, to, filter);
   throw std::runtime_error(
       "Unsupported H5::DataType for event_time_offset in NXevent_data");
 }
@@ -145,9 +155,12 @@ void MultiProcessEventLoader::GroupLoader<
     loadFromGroup(EventsListsShmemStorage &storage, const H5::Group &instrument,
                   const std::vector<std::string> &bankNames,
                   const std::vector<int32_t> &bankOffsets,
-                  const std::size_t from, const std::size_t to) {
+                  const std::size_t from, const std::size_t to,
+                  const EventFilter &filter) {
   std::vector<int32_t> eventId;
   std::vector<T> eventTimeOffset;
+  std::vector<TofEvent> events;
+  std::vector<int32_t> pixels;
 
   std::size_t eventCounter{0};
   auto bankSizes = EventLoader::readBankSizes(instrument, bankNames);
@@ -176,8 +189,24 @@ void MultiProcessEventLoader::GroupLoader<
       detail::eventIdToGlobalSpectrumIndex(eventId.data(), cnt,
                                            bankOffsets[bankIdx]);
 
+      // Build and filter the events first, so that only the accepted ones
+      // are counted and take space in shared memory
+      events.clear();
+      pixels.clear();
+      events.reserve(cnt);
+      pixels.reserve(cnt);
+      part->setEventOffset(start);
+      for (std::size_t i = 0; i < cnt; ++i) {
+        TofEvent event{boost::numeric_cast<ToFType>(eventTimeOffset[i]),
+                       part->next()};
+        if (filter.accepts(event)) {
+          events.emplace_back(event);
+          pixels.emplace_back(eventId[i]);
+        }
+      }
+
       std::unordered_map<int32_t, std::size_t> eventsPerPixel;
-      for (auto &pixId : eventId) {
+      for (auto &pixId : pixels) {
         auto iter = eventsPerPixel.find(pixId);
         if (iter == eventsPerPixel.end())
           iter = eventsPerPixel.insert(std::make_pair(pixId, 0)).first;
@@ -187,13 +216,9 @@ void MultiProcessEventLoader::GroupLoader<
       for (const auto &pair : eventsPerPixel)
         storage.reserve(0, pair.first, pair.second);
 
-      part->setEventOffset(start);
-      for (std::size_t i = 0; i < eventId.size(); ++i) {
+      for (std::size_t i = 0; i < events.size(); ++i) {
         try {
-          storage.appendEvent(
-              0, eventId[i],
-              TofEvent{boost::numeric_cast<ToFType>(eventTimeOffset[i]),
-                       part->next()});
+          storage.appendEvent(0, pixels[i], events[i]);
         } catch (...) {
           std::throw_with_nested(
               std::runtime_error("Something wrong in multiprocess "
@@ -217,7 +242,8 @@ void MultiProcessEventLoader::GroupLoader<
     loadFromGroup(EventsListsShmemStorage &storage, const H5::Group &instrument,
                   const std::vector<std::string> &bankNames,
                   const std::vector<int32_t> &bankOffsets,
-                  const std::size_t from, const std::size_t to) {
+                  const std::size_t from, const std::size_t to,
+                  const EventFilter &filter) {
   constexpr std::size_t chunksPerBank{10};
   const std::size_t chLen{
       std::max<std::size_t>((to - from) / chunksPerBank, 1)};
@@ -324,10 +350,11 @@ void MultiProcessEventLoader::GroupLoader<
           auto &task = tasks[tn];
           task.partitioner->setEventOffset(task.from);
           for (unsigned i = 0; i < task.eventId.size(); ++i) {
-            pixels.at(task.eventId[i])
-                .emplace_back(
-                    boost::numeric_cast<ToFType>(task.eventTimeOffset[i]),
-                    task.partitioner->next());
+            TofEvent event{
+                boost::numeric_cast<ToFType>(task.eventTimeOffset[i]),
+                task.partitioner->next()};
+            if (filter.accepts(event))
+              pixels.at(task.eventId[i]).emplace_back(event);
           }
           task.eventId.resize(0);
           task.eventId.shrink_to_fit();
@@ -56,12 +56,13 @@ void load(
        bankNames, bankOffsets, std::move(eventLists));
 }
 
-/// Load events from given banks into event lists.
+/// Load events from given banks into event lists, in child processes. Only the
+/// events accepted by the filter are loaded.
 void load(const std::string &filename, const std::string &groupname,
           const std::vector<std::string> &bankNames,
           const std::vector<int32_t> &bankOffsets,
           const std::vector<std::vector<Types::Event::TofEvent> *> &eventLists,
-          bool precalcEvents) {
+          bool precalcEvents, const EventFilter &filter) {
   auto concurencyNumber = PARALLEL_GET_MAX_THREADS;
   auto numThreads = std::max<int>(concurencyNumber / 2, 1);
   auto numProceses = std::max<int>(concurencyNumber / 2, 1);
@@ -72,7 +73,7 @@ void load(const std::string &filename, const std::string &groupname,
   MultiProcessEventLoader loader(static_cast<unsigned>(eventLists.size()),
                                  numProceses, numThreads, executableName,
                                  precalcEvents);
-  loader.load(filename, groupname, bankNames, bankOffsets, eventLists);
+  loader.load(filename, groupname, bankNames, bankOffsets, eventLists, filter);
 }
 
 } // namespace EventLoader
@@ -4,6 +4,7 @@
 //   NScD Oak Ridge National Laboratory, European Spallation Source,
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidParallel/IO/EventFilter.h"
 #include "MantidParallel/IO/EventsListsShmemStorage.h"
 #include "MantidParallel/IO/MultiProcessEventLoader.h"
 #include "MantidTypes/Event/TofEvent.h"
@@ -22,10 +23,15 @@ int main(int argc, char **argv) {
   const std::string fileName(argv[8]);
   const std::string groupName(argv[9]);
   const bool precalcEvents = std::atoi(argv[10]);
+  EventFilter filter;
+  filter.tofMin = std::stod(argv[11]);
+  filter.tofMax = std::stod(argv[12]);
+  filter.pulseTimeMin = std::stoll(argv[13]);
+  filter.pulseTimeMax = std::stoll(argv[14]);
 
   std::vector<std::string> bankNames;
   std::vector<int32_t> bankOffsets;
-  for (int i = 11; i < argc; i += 2) {
+  for (int i = 15; i < argc; i += 2) {
     bankNames.emplace_back(argv[i]);
     bankOffsets.emplace_back(std::atoi(argv[i + 1]));
   }
@@ -34,7 +40,7 @@ int main(int argc, char **argv) {
   try {
     MultiProcessEventLoader::fillFromFile(storage, fileName, groupName,
                                           bankNames, bankOffsets, firstEvent,
-                                          upperEvent, precalcEvents);
+                                          upperEvent, precalcEvents, filter);
   } catch (...) {
     return 1;
   }
@@ -10,7 +10,9 @@
 #include <chrono>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <numeric>
+#include <sstream>
 #include <thread>
 
 #include "MantidParallel/IO/MultiProcessEventLoader.h"
@@ -23,6 +25,15 @@ namespace Mantid {
 namespace Parallel {
 namespace IO {
 
+namespace {
+/// Format a number for the command line of a child process, without loss
+template <typename T> std::string toArgument(const T value) {
+  std::ostringstream stream;
+  stream << std::setprecision(std::numeric_limits<T>::max_digits10) << value;
+  return stream.str();
+}
+} // namespace
+
 /// Constructor
 MultiProcessEventLoader::MultiProcessEventLoader(uint32_t numPixels,
                                                  uint32_t numProcesses,
@@ -63,12 +74,14 @@ std::string MultiProcessEventLoader::generateTimeBasedPrefix() {
 }
 
 /**Main API function for loading data from given file, group list of banks,
- * launches child processes for hdf5 parallel reading*/
+ * launches child processes for hdf5 parallel reading. Only the events accepted
+ * by the filter are loaded.*/
 void MultiProcessEventLoader::load(
     const std::string &filename, const std::string &groupname,
     const std::vector<std::string> &bankNames,
     const std::vector<int32_t> &bankOffsets,
-    std::vector<std::vector<Types::Event::TofEvent> *> eventLists) const {
+    std::vector<std::vector<Types::Event::TofEvent> *> eventLists,
+    const EventFilter &filter) const {
 
   try {
     H5::H5File file(filename.c_str(), H5F_ACC_RDONLY);
@@ -150,6 +163,10 @@ void MultiProcessEventLoader::load(
       processArgs.emplace_back(
           m_precalculateEvents ? "1 "
                                : "0 "); // variant of algorithm used for loading
+      processArgs.emplace_back(toArgument(filter.tofMin));
+      processArgs.emplace_back(toArgument(filter.tofMax));
+      processArgs.emplace_back(toArgument(filter.pulseTimeMin));
+      processArgs.emplace_back(toArgument(filter.pulseTimeMax));
       for (unsigned j = 0; j < bankNames.size(); ++j) {
         processArgs.emplace_back(bankNames[j]);                   // bank name
         processArgs.emplace_back(std::to_string(bankOffsets[j])); // bank size
@@ -192,49 +209,59 @@ void MultiProcessEventLoader::load(
   }
 }
 
-/**Collects data from the chunks in shared memory to the final structure*/
+/**Collects data from the chunks in shared memory to the final structure.
+ * Each event list is sized once for its events from all the chunks, so the
+ * events are copied exactly once.*/
 void MultiProcessEventLoader::assembleFromShared(
     std::vector<std::vector<Mantid::Types::Event::TofEvent> *> &result) const {
-  std::vector<std::thread> workers;
-
-  std::vector<std::atomic<uint32_t>> cnts(m_segmentNames.size());
-  std::fill(cnts.begin(), cnts.end(), 0);
-  std::vector<std::atomic<uint32_t>> processCounter(m_segmentNames.size());
-  std::fill(processCounter.begin(), processCounter.end(), 0);
+  std::vector<ip::managed_shared_memory> segments;
+  std::vector<const Chunks *> segmentChunks;
+  segments.reserve(m_segmentNames.size());
+  for (const auto &name : m_segmentNames) {
+    segments.emplace_back(ip::open_read_only, name.c_str());
+    const auto chunks =
+        segments.back().find<Chunks>(m_storageName.c_str()).first;
+    if (!chunks)
+      throw std::runtime_error("No events in shared memory segment " + name);
+    segmentChunks.emplace_back(chunks);
+  }
 
   const unsigned portion{std::max<unsigned>(m_numPixels / m_numThreads / 3, 1)};
-
+  std::atomic<uint32_t> nextPixel{0};
+  std::vector<std::exception_ptr> exceptions(m_numThreads);
+  std::vector<std::thread> workers;
   for (unsigned i = 0; i < m_numThreads; ++i) {
-    workers.emplace_back([&]() {
-      for (std::size_t segId = 0; segId < m_segmentNames.size(); ++segId) {
-        ip::managed_shared_memory segment{ip::open_read_only,
-                                          m_segmentNames[segId].c_str()};
-        auto chunks =
-            segment.find<Mantid::Parallel::IO::Chunks>(m_storageName.c_str())
-                .first;
-        auto &cnt = cnts[segId];
-        for (uint32_t startPixel = cnt.fetch_add(portion);
-             startPixel < m_numPixels; startPixel = cnt.fetch_add(portion)) {
+    workers.emplace_back([&, i]() {
+      try {
+        for (uint32_t startPixel = nextPixel.fetch_add(portion);
+             startPixel < m_numPixels;
+             startPixel = nextPixel.fetch_add(portion)) {
           auto toPixel = std::min(startPixel + portion, m_numPixels);
           for (uint32_t pixel = startPixel; pixel < toPixel; ++pixel) {
-            auto &res = result[pixel];
-            for (auto &ch : *chunks) {
-              res->insert(res->end(), ch[pixel].begin(), ch[pixel].end());
-            }
+            auto res = result[pixel];
+            if (!res)
+              continue;
+            auto size = res->size();
+            for (const auto chunks : segmentChunks)
+              for (const auto &ch : *chunks)
+                size += ch[pixel].size();
+            res->reserve(size);
+            for (const auto chunks : segmentChunks)
+              for (const auto &ch : *chunks)
+                res->insert(res->end(), ch[pixel].begin(), ch[pixel].end());
           }
         }
-        ++processCounter[segId];
-        if (processCounter[segId] == m_numThreads)
-          ip::shared_memory_object::remove(m_segmentNames[segId].c_str());
-
-        while (processCounter[segId] != m_numThreads)
-          ;
+      } catch (...) {
+        exceptions[i] = std::current_exception();
       }
     });
   }
 
   for (auto &worker : workers)
     worker.join();
+  for (const auto &exception : exceptions)
+    if (exception)
+      std::rethrow_exception(exception);
 }
 
 /**Wrapper for loading the PART of ("from" event "to" event) data
@@ -243,7 +270,7 @@ void MultiProcessEventLoader::fillFromFile(
     EventsListsShmemStorage &storage, const std::string &filename,
     const std::string &groupname, const std::vector<std::string> &bankNames,
     const std::vector<int32_t> &bankOffsets, const std::size_t from,
-    const std::size_t to, bool precalc) {
+    const std::size_t to, bool precalc, const EventFilter &filter) {
   H5::H5File file(filename.c_str(), H5F_ACC_RDONLY);
   auto instrument = file.openGroup(groupname);
 
@@ -252,10 +279,10 @@ void MultiProcessEventLoader::fillFromFile(
 
   if (precalc)
     return GroupLoader<LoadType::preCalcEvents>::loadFromGroupWrapper(
-        type, storage, instrument, bankNames, bankOffsets, from, to);
+        type, storage, instrument, bankNames, bankOffsets, from, to, filter);
   else
     return GroupLoader<LoadType::producerConsumer>::loadFromGroupWrapper(
-        type, storage, instrument, bankNames, bankOffsets, from, to);
+        type, storage, instrument, bankNames, bankOffsets, from, to, filter);
 }
 
 // Estimates the memory amount for shared memory segments
@@ -0,0 +1,49 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidParallel/IO/EventFilter.h"
+
+using Mantid::Parallel::IO::EventFilter;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+class EventFilterTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventFilterTest *createSuite() { return new EventFilterTest(); }
+  static void destroySuite(EventFilterTest *suite) { delete suite; }
+
+  void test_default_accepts_all_events() {
+    EventFilter filter;
+    TS_ASSERT(filter.accepts(TofEvent(-1e20, DateAndTime::minimum())));
+    TS_ASSERT(filter.accepts(TofEvent(1e20, DateAndTime::maximum())));
+  }
+
+  void test_tof_limits_are_included() {
+    EventFilter filter;
+    filter.tofMin = 10.;
+    filter.tofMax = 20.;
+    TS_ASSERT(!filter.accepts(TofEvent(9.5, DateAndTime(0))));
+    TS_ASSERT(filter.accepts(TofEvent(10., DateAndTime(0))));
+    TS_ASSERT(filter.accepts(TofEvent(20., DateAndTime(0))));
+    TS_ASSERT(!filter.accepts(TofEvent(20.5, DateAndTime(0))));
+  }
+
+  void test_pulse_time_limits_are_included() {
+    EventFilter filter;
+    filter.pulseTimeMin = 1000;
+    filter.pulseTimeMax = 2000;
+    TS_ASSERT(!filter.accepts(TofEvent(1., DateAndTime(int64_t(999)))));
+    TS_ASSERT(filter.accepts(TofEvent(1., DateAndTime(int64_t(1000)))));
+    TS_ASSERT(filter.accepts(TofEvent(1., DateAndTime(int64_t(2000)))));
+    TS_ASSERT(!filter.accepts(TofEvent(1., DateAndTime(int64_t(2001)))));
+  }
+};
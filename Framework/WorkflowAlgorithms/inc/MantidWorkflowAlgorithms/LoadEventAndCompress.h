@@ -38,9 +38,12 @@ protected:
 private:
   void init() override;
   void exec() override;
+  std::map<std::string, std::string> validateInputs() override;
 
   API::ITableWorkspace_sptr m_chunkingTable;
   double m_filterBadPulses;
+  /// Let LoadEventNexus compress the events as it reads them
+  bool m_compressWhileReading{false};
 };
 
 } // namespace WorkflowAlgorithms
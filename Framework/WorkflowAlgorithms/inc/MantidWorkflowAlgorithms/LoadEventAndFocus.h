@@ -0,0 +1,71 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DataProcessorAlgorithm.h"
+#include "MantidAPI/ITableWorkspace_fwd.h"
+#include "MantidGeometry/IDTypes.h"
+#include "MantidKernel/System.h"
+
+namespace Mantid {
+namespace DataObjects {
+class EventWorkspace;
+}
+namespace WorkflowAlgorithms {
+
+/** LoadEventAndFocus : Load an event NeXus file chunk by chunk, and focus the
+  events of each chunk straight into d-spacing histograms of the groups of a
+  grouping workspace. The events of a chunk are dropped once focused, so the
+  memory used does not grow with the number of events in the file.
+ */
+class DLLExport LoadEventAndFocus : public API::DataProcessorAlgorithm {
+public:
+  const std::string name() const override;
+  int version() const override;
+  const std::vector<std::string> seeAlso() const override {
+    return {"LoadEventNexus", "AlignDetectors", "DiffractionFocussing",
+            "LoadEventAndCompress"};
+  }
+  const std::string category() const override;
+  const std::string summary() const override;
+
+  static double defaultMaxChunkSize();
+
+protected:
+  API::ITableWorkspace_sptr
+  determineChunk(const std::string &filename) override;
+  API::MatrixWorkspace_sptr loadChunk(const size_t rowIndex) override;
+
+private:
+  void init() override;
+  void exec() override;
+  std::map<std::string, std::string> validateInputs() override;
+
+  void readCalibration();
+  void readGrouping();
+  void focusChunk(const DataObjects::EventWorkspace &chunk,
+                  const std::vector<double> &edges,
+                  std::vector<std::vector<double>> &counts,
+                  std::vector<std::vector<double>> &errorsSquared);
+
+  API::ITableWorkspace_sptr m_chunkingTable;
+  /// DIFC of each detector ID, zero if the detector is not calibrated
+  std::vector<double> m_difc;
+  /// DIFA of each detector ID
+  std::vector<double> m_difa;
+  /// TZERO of each detector ID
+  std::vector<double> m_tzero;
+  /// Output workspace index of each detector ID, -1 if it is not grouped
+  std::vector<int> m_detIDToIndex;
+  /// Group number of each output workspace index
+  std::vector<int> m_groups;
+  /// Detector IDs of each output workspace index
+  std::vector<std::vector<detid_t>> m_groupDetIDs;
+};
+
+} // namespace WorkflowAlgorithms
+} // namespace Mantid
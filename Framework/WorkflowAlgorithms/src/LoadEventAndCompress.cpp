@@ -63,6 +63,7 @@ void LoadEventAndCompress::init() {
   copyProperty(algLoadEventNexus, "OutputWorkspace");
   copyProperty(algDetermineChunking, "MaxChunkSize");
   declareProperty("CompressTOFTolerance", .01);
+  copyProperty(algLoadEventNexus, "CompressBinningMode");
 
   copyProperty(algLoadEventNexus, "FilterByTofMin");
   copyProperty(algLoadEventNexus, "FilterByTofMax");
@@ -76,6 +77,7 @@ void LoadEventAndCompress::init() {
   setPropertyGroup("FilterByTimeStop", grp1);
 
   copyProperty(algLoadEventNexus, "NXentryName");
+  copyProperty(algLoadEventNexus, "LoadType");
   copyProperty(algLoadEventNexus, "LoadMonitors");
   copyProperty(algLoadEventNexus, "MonitorsLoadOnly");
   copyProperty(algLoadEventNexus, "FilterMonByTofMin");
@@ -110,6 +112,22 @@ void LoadEventAndCompress::init() {
   declareProperty("FilterBadPulses", 95., range);
 }
 
+std::map<std::string, std::string> LoadEventAndCompress::validateInputs() {
+  std::map<std::string, std::string> result;
+
+  // Events binned while reading lose their pulse time, which FilterBadPulses
+  // needs to find the events of the bad pulses
+  const double tolerance = getProperty("CompressTOFTolerance");
+  const double filterBadPulses = getProperty("FilterBadPulses");
+  if (tolerance > 0. && getPropertyValue("CompressBinningMode") == "Linear" &&
+      filterBadPulses > 0.)
+    result["CompressBinningMode"] =
+        "Linear binning drops the pulse times of the events, so bad pulses "
+        "cannot be filtered. Set FilterBadPulses to 0 or use Exact binning.";
+
+  return result;
+}
+
 /// @see DataProcessorAlgorithm::determineChunk(const std::string &)
 ITableWorkspace_sptr
 LoadEventAndCompress::determineChunk(const std::string &filename) {
@@ -145,8 +163,14 @@ MatrixWorkspace_sptr LoadEventAndCompress::loadChunk(const size_t rowIndex) {
   alg->setProperty<double>("FilterByTimeStart",
                            getProperty("FilterByTimeStart"));
   alg->setProperty<double>("FilterByTimeStop", getProperty("FilterByTimeStop"));
+  if (m_compressWhileReading) {
+    alg->setProperty<double>("CompressTolerance",
+                             getProperty("CompressTOFTolerance"));
+    alg->setProperty<string>("CompressBinningMode", "Linear");
+  }
 
   alg->setProperty<string>("NXentryName", getProperty("NXentryName"));
+  alg->setProperty<string>("LoadType", getProperty("LoadType"));
   alg->setProperty<bool>("LoadMonitors", getProperty("LoadMonitors"));
   alg->setProperty<string>("MonitorsLoadOnly", getProperty("MonitorsLoadOnly"));
   alg->setProperty<double>("FilterMonByTofMin",
@@ -203,6 +227,10 @@ LoadEventAndCompress::processChunk(API::MatrixWorkspace_sptr &wksp) {
     eventWS = filterBadPulsesAlgo->getProperty("OutputWorkspace");
   }
 
+  // Events compressed by the loader are not compressed again
+  if (m_compressWhileReading)
+    return eventWS;
+
   auto compressEvents = createChildAlgorithm("CompressEvents");
   compressEvents->setProperty("InputWorkspace", eventWS);
   compressEvents->setProperty("OutputWorkspace", eventWS);
@@ -220,6 +248,9 @@ LoadEventAndCompress::processChunk(API::MatrixWorkspace_sptr &wksp) {
 void LoadEventAndCompress::exec() {
   const std::string filename = getPropertyValue("Filename");
   m_filterBadPulses = getProperty("FilterBadPulses");
+  const double tolerance = getProperty("CompressTOFTolerance");
+  m_compressWhileReading =
+      tolerance > 0. && getPropertyValue("CompressBinningMode") == "Linear";
 
   m_chunkingTable = determineChunk(filename);
 
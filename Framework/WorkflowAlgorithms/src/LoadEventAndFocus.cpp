@@ -0,0 +1,478 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidWorkflowAlgorithms/LoadEventAndFocus.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/Progress.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidDataObjects/EventBinner.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidHistogramData/BinEdges.h"
+#include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/RebinParamsValidator.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidKernel/VectorHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+namespace Mantid {
+namespace WorkflowAlgorithms {
+
+using std::size_t;
+using std::string;
+using namespace Kernel;
+using namespace API;
+using namespace DataObjects;
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(LoadEventAndFocus)
+
+namespace {
+/// Applies the equation d=(TOF-tzero)/difc
+struct TofToDLinear {
+  TofToDLinear(const double difc, const double tzero)
+      : factor(1. / difc), offset(-1. * tzero / difc) {}
+
+  double operator()(const double tof) const { return factor * tof + offset; }
+
+  /// 1./difc
+  double factor;
+  /// -tzero/difc
+  double offset;
+};
+
+/// Inverts the equation TOF=difc*d+difa*d^2+tzero
+struct TofToDQuadratic {
+  TofToDQuadratic(const double difc, const double difa, const double tzero)
+      : factor1(-0.5 * difc / difa), factor2(1. / difa),
+        factor3(factor1 * factor1 - tzero / difa) {}
+
+  double operator()(const double tof) const {
+    const double second = std::sqrt(tof * factor2 + factor3);
+    return second < factor1 ? factor1 - second : factor1 + second;
+  }
+
+  /// -0.5*difc/difa
+  double factor1;
+  /// 1/difa
+  double factor2;
+  /// (0.5*difc/difa)^2 - (tzero/difa)
+  double factor3;
+};
+
+/** Add the weights and squared errors of events to the histogram of their
+ * d-spacing.
+ * @param events :: the events to focus
+ * @param toD :: converts a time-of-flight to d-spacing
+ * @param binner :: finds the bins of the histogram
+ * @param edges :: the bin edges of the histogram, in d-spacing
+ * @param counts :: the counts of the histogram
+ * @param errorsSquared :: the squared errors of the histogram
+ */
+template <typename T, typename CONVERT>
+void focusEvents(const std::vector<T> &events, const CONVERT &toD,
+                 const EventBinner &binner, const std::vector<double> &edges,
+                 double *counts, double *errorsSquared) {
+  const auto add = [counts, errorsSquared](const size_t bin, const T &event) {
+    counts[bin] += event.weight();
+    errorsSquared[bin] += event.errorSquared();
+  };
+  if (binner.isClosedForm()) {
+    binner.binEvents(
+        events, [&toD](const T &event) { return toD(event.tof()); }, add);
+    return;
+  }
+  for (const auto &event : events) {
+    const double d = toD(event.tof());
+    // Also drops NaN
+    if (!(d >= edges.front() && d < edges.back()))
+      continue;
+    const auto bin = std::upper_bound(edges.cbegin(), edges.cend(), d) -
+                     edges.cbegin() - 1;
+    add(static_cast<size_t>(bin), event);
+  }
+}
+
+/// Focus the events of an event list, whatever their type
+template <typename CONVERT>
+void focusEventList(const EventList &eventList, const CONVERT &toD,
+                    const EventBinner &binner,
+                    const std::vector<double> &edges, double *counts,
+                    double *errorsSquared) {
+  switch (eventList.getEventType()) {
+  case EventType::TOF: {
+    const std::vector<Types::Event::TofEvent> *events;
+    getEventsFrom(eventList, events);
+    focusEvents(*events, toD, binner, edges, counts, errorsSquared);
+    break;
+  }
+  case EventType::WEIGHTED: {
+    const std::vector<WeightedEvent> *events;
+    getEventsFrom(eventList, events);
+    focusEvents(*events, toD, binner, edges, counts, errorsSquared);
+    break;
+  }
+  case EventType::WEIGHTED_NOTIME: {
+    const std::vector<WeightedEventNoTime> *events;
+    getEventsFrom(eventList, events);
+    focusEvents(*events, toD, binner, edges, counts, errorsSquared);
+    break;
+  }
+  }
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+
+/// Algorithms name for identification. @see Algorithm::name
+const string LoadEventAndFocus::name() const { return "LoadEventAndFocus"; }
+
+/// Algorithm's version for identification. @see Algorithm::version
+int LoadEventAndFocus::version() const { return 1; }
+
+/// Algorithm's category for identification. @see Algorithm::category
+const string LoadEventAndFocus::category() const {
+  return "Workflow\\Diffraction";
+}
+
+/// Algorithm's summary for use in the GUI and help. @see Algorithm::summary
+const string LoadEventAndFocus::summary() const {
+  return "Load an event file by chunks and focus the events into d-spacing "
+         "histograms, without keeping the events in memory";
+}
+
+//----------------------------------------------------------------------------------------------
+/** Initialize the algorithm's properties.
+ */
+void LoadEventAndFocus::init() {
+  // algorithms to copy properties from
+  auto algLoadEventNexus =
+      AlgorithmManager::Instance().createUnmanaged("LoadEventNexus");
+  algLoadEventNexus->initialize();
+
+  // declare properties
+  copyProperty(algLoadEventNexus, "Filename");
+  declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "The focused workspace, in d-spacing");
+  auto mustBePositive = std::make_shared<BoundedValidator<double>>();
+  mustBePositive->setLower(0.0);
+  declareProperty("MaxChunkSize", EMPTY_DBL(), mustBePositive,
+                  "Load the file in chunks of at most this number of Gbytes. "
+                  "If not set, or zero, chunks of a quarter of the available "
+                  "memory are used.");
+  declareProperty(std::make_unique<WorkspaceProperty<ITableWorkspace>>(
+                      "CalibrationWorkspace", "", Direction::Input),
+                  "Table of the DIFC of the detectors, with columns 'detid', "
+                  "'difc' and optionally 'difa' and 'tzero', as created by "
+                  "LoadDiffCal");
+  declareProperty(std::make_unique<WorkspaceProperty<GroupingWorkspace>>(
+                      "GroupingWorkspace", "", Direction::Input),
+                  "The detectors of each group to focus. Events of detectors "
+                  "in no group are dropped");
+  declareProperty(
+      std::make_unique<ArrayProperty<double>>(
+          "Params", std::make_shared<RebinParamsValidator>()),
+      "The d-spacing binning of the focused histograms, as in Rebin");
+
+  copyProperty(algLoadEventNexus, "FilterByTofMin");
+  copyProperty(algLoadEventNexus, "FilterByTofMax");
+  copyProperty(algLoadEventNexus, "FilterByTimeStart");
+  copyProperty(algLoadEventNexus, "FilterByTimeStop");
+
+  std::string grp1 = "Filter Events";
+  setPropertyGroup("FilterByTofMin", grp1);
+  setPropertyGroup("FilterByTofMax", grp1);
+  setPropertyGroup("FilterByTimeStart", grp1);
+  setPropertyGroup("FilterByTimeStop", grp1);
+
+  copyProperty(algLoadEventNexus, "NXentryName");
+}
+
+std::map<std::string, std::string> LoadEventAndFocus::validateInputs() {
+  std::map<std::string, std::string> result;
+
+  ITableWorkspace_const_sptr calibration =
+      getProperty("CalibrationWorkspace");
+  if (calibration) {
+    const auto columns = calibration->getColumnNames();
+    for (const auto &name : {"detid", "difc"}) {
+      if (std::find(columns.cbegin(), columns.cend(), name) == columns.cend())
+        result["CalibrationWorkspace"] =
+            "The table has no '" + std::string(name) + "' column";
+    }
+  }
+
+  return result;
+}
+
+/** Size of the chunks, in Gbytes, when MaxChunkSize is not set: a quarter of
+ * the available memory, so that a large file is never loaded at once.
+ * @return the size; zero if the available memory is not known
+ */
+double LoadEventAndFocus::defaultMaxChunkSize() {
+  MemoryStats memory;
+  // availMem() is in kiB
+  return static_cast<double>(memory.availMem()) / (4. * 1024. * 1024.);
+}
+
+/// @see DataProcessorAlgorithm::determineChunk(const std::string &)
+ITableWorkspace_sptr
+LoadEventAndFocus::determineChunk(const std::string &filename) {
+  double maxChunkSize = getProperty("MaxChunkSize");
+  if (isEmpty(maxChunkSize) || maxChunkSize == 0.) {
+    maxChunkSize = defaultMaxChunkSize();
+    g_log.information() << "Loading chunks of at most " << maxChunkSize
+                        << " Gbytes\n";
+  }
+
+  auto alg = createChildAlgorithm("DetermineChunking");
+  alg->setProperty("Filename", filename);
+  alg->setProperty("MaxChunkSize", maxChunkSize);
+  alg->executeAsChildAlg();
+  ITableWorkspace_sptr chunkingTable = alg->getProperty("OutputWorkspace");
+
+  if (chunkingTable->rowCount() > 1)
+    g_log.information() << "Will load data in " << chunkingTable->rowCount()
+                        << " chunks\n";
+  else
+    g_log.information("Not chunking");
+
+  return chunkingTable;
+}
+
+/// @see DataProcessorAlgorithm::loadChunk(const size_t)
+MatrixWorkspace_sptr LoadEventAndFocus::loadChunk(const size_t rowIndex) {
+  g_log.debug() << "loadChunk(" << rowIndex << ")\n";
+
+  const auto rowCount = m_chunkingTable->rowCount();
+  const auto numChunks = static_cast<double>(std::max<size_t>(rowCount, 1));
+  double progStart = 0.9 * static_cast<double>(rowIndex) / numChunks;
+  double progStop = 0.9 * static_cast<double>(rowIndex + 1) / numChunks;
+
+  auto alg = createChildAlgorithm("LoadEventNexus", progStart, progStop);
+  alg->setProperty<string>("Filename", getProperty("Filename"));
+  alg->setProperty<double>("FilterByTofMin", getProperty("FilterByTofMin"));
+  alg->setProperty<double>("FilterByTofMax", getProperty("FilterByTofMax"));
+  alg->setProperty<double>("FilterByTimeStart",
+                           getProperty("FilterByTimeStart"));
+  alg->setProperty<double>("FilterByTimeStop", getProperty("FilterByTimeStop"));
+  alg->setProperty<string>("NXentryName", getProperty("NXentryName"));
+  alg->setProperty<bool>("LoadMonitors", false);
+
+  // logs are the same in every chunk, and are only kept from the first one,
+  // unless the events are filtered by time
+  const double filterByTimeStart = getProperty("FilterByTimeStart");
+  const double filterByTimeStop = getProperty("FilterByTimeStop");
+  alg->setProperty<bool>("LoadLogs", rowIndex == 0 ||
+                                         !isEmpty(filterByTimeStart) ||
+                                         !isEmpty(filterByTimeStop));
+
+  // set chunking information
+  if (rowCount > 0) {
+    const std::vector<string> COL_NAMES = m_chunkingTable->getColumnNames();
+    for (const auto &name : COL_NAMES) {
+      alg->setProperty(name, m_chunkingTable->getRef<int>(name, rowIndex));
+    }
+  }
+
+  alg->executeAsChildAlg();
+  Workspace_sptr wksp = alg->getProperty("OutputWorkspace");
+  return std::dynamic_pointer_cast<MatrixWorkspace>(wksp);
+}
+
+/// Read the DIFC, DIFA and TZERO of each detector ID from the calibration
+void LoadEventAndFocus::readCalibration() {
+  ITableWorkspace_const_sptr calibration =
+      getProperty("CalibrationWorkspace");
+  const auto columns = calibration->getColumnNames();
+  const auto hasColumn = [&columns](const std::string &name) {
+    return std::find(columns.cbegin(), columns.cend(), name) != columns.cend();
+  };
+  auto difcColumn = calibration->getColumn("difc");
+  auto difaColumn =
+      hasColumn("difa") ? calibration->getColumn("difa") : nullptr;
+  auto tzeroColumn =
+      hasColumn("tzero") ? calibration->getColumn("tzero") : nullptr;
+
+  ConstColumnVector<int> detIDs = calibration->getVector("detid");
+  size_t size = 0;
+  for (size_t row = 0; row < detIDs.size(); ++row)
+    size = std::max(size, static_cast<size_t>(std::max(detIDs[row] + 1, 0)));
+  m_difc.assign(size, 0.);
+  m_difa.assign(size, 0.);
+  m_tzero.assign(size, 0.);
+  for (size_t row = 0; row < detIDs.size(); ++row) {
+    // if you need negative detector ids, use AlignDetectors
+    if (detIDs[row] < 0)
+      continue;
+    const auto detID = static_cast<size_t>(detIDs[row]);
+    m_difc[detID] = difcColumn->toDouble(row);
+    if (difaColumn)
+      m_difa[detID] = difaColumn->toDouble(row);
+    if (tzeroColumn)
+      m_tzero[detID] = tzeroColumn->toDouble(row);
+  }
+}
+
+/// Map the detector IDs to the output workspace index of their group
+void LoadEventAndFocus::readGrouping() {
+  GroupingWorkspace_const_sptr grouping = getProperty("GroupingWorkspace");
+  std::vector<int> detIDToGroup;
+  int64_t numGroups;
+  grouping->makeDetectorIDToGroupVector(detIDToGroup, numGroups);
+
+  // One spectrum per group number in use, in increasing order
+  std::vector<int> groupToIndex(static_cast<size_t>(numGroups) + 1, -1);
+  for (const auto group : detIDToGroup) {
+    if (group > 0)
+      groupToIndex[group] = 0;
+  }
+  m_groups.clear();
+  for (size_t group = 1; group < groupToIndex.size(); ++group) {
+    if (groupToIndex[group] == 0) {
+      groupToIndex[group] = static_cast<int>(m_groups.size());
+      m_groups.emplace_back(static_cast<int>(group));
+    }
+  }
+
+  m_detIDToIndex.assign(detIDToGroup.size(), -1);
+  m_groupDetIDs.assign(m_groups.size(), std::vector<detid_t>());
+  for (size_t detID = 0; detID < detIDToGroup.size(); ++detID) {
+    const auto group = detIDToGroup[detID];
+    if (group <= 0)
+      continue;
+    const auto index = groupToIndex[group];
+    m_detIDToIndex[detID] = index;
+    m_groupDetIDs[index].emplace_back(static_cast<detid_t>(detID));
+  }
+}
+
+/** Add the events of a chunk to the focused histograms.
+ * @param chunk :: the events loaded from the file
+ * @param edges :: the d-spacing bin edges of the focused histograms
+ * @param counts :: for each thread, the counts of the focused histograms,
+ * one after the other
+ * @param errorsSquared :: for each thread, the squared errors of the focused
+ * histograms, one after the other
+ */
+void LoadEventAndFocus::focusChunk(
+    const EventWorkspace &chunk, const std::vector<double> &edges,
+    std::vector<std::vector<double>> &counts,
+    std::vector<std::vector<double>> &errorsSquared) {
+  const EventBinner binner(edges);
+  const size_t numBins = edges.size() - 1;
+  const auto numSpectra = static_cast<int64_t>(chunk.getNumberHistograms());
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t wi = 0; wi < numSpectra; ++wi) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &eventList = chunk.getSpectrum(wi);
+    const auto &detIDs = eventList.getDetectorIDs();
+    if (eventList.getNumberEvents() == 0 || detIDs.empty())
+      continue;
+    // LoadEventNexus gives one detector per spectrum
+    const auto detID = *detIDs.begin();
+    if (detID < 0 || static_cast<size_t>(detID) >= m_detIDToIndex.size() ||
+        static_cast<size_t>(detID) >= m_difc.size())
+      continue;
+    const auto index = m_detIDToIndex[detID];
+    const double difc = m_difc[detID];
+    if (index < 0 || difc <= 0.)
+      continue;
+
+    const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+    const auto offset = static_cast<size_t>(index) * numBins;
+    double *groupCounts = counts[thread].data() + offset;
+    double *groupErrors = errorsSquared[thread].data() + offset;
+    const double difa = m_difa[detID];
+    if (difa == 0.)
+      focusEventList(eventList, TofToDLinear(difc, m_tzero[detID]), binner,
+                     edges, groupCounts, groupErrors);
+    else
+      focusEventList(eventList, TofToDQuadratic(difc, difa, m_tzero[detID]),
+                     binner, edges, groupCounts, groupErrors);
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+}
+
+//----------------------------------------------------------------------------------------------
+/** Execute the algorithm.
+ */
+void LoadEventAndFocus::exec() {
+  const std::string filename = getPropertyValue("Filename");
+  const std::vector<double> params = getProperty("Params");
+
+  readCalibration();
+  readGrouping();
+  if (m_groups.empty())
+    throw std::runtime_error("The grouping workspace has no group");
+
+  std::vector<double> edges;
+  VectorHelper::createAxisFromRebinParams(params, edges);
+  const size_t numBins = edges.size() - 1;
+
+  // The histograms are summed in each thread separately, so their size, not
+  // the number of events, sets the memory used
+  const size_t numThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  std::vector<std::vector<double>> counts(
+      numThreads, std::vector<double>(m_groups.size() * numBins, 0.));
+  auto errorsSquared = counts;
+
+  m_chunkingTable = determineChunk(filename);
+  const size_t numChunks = std::max<size_t>(m_chunkingTable->rowCount(), 1);
+
+  MatrixWorkspace_sptr outputWS;
+  for (size_t i = 0; i < numChunks; ++i) {
+    auto chunk = std::dynamic_pointer_cast<EventWorkspace>(loadChunk(i));
+    if (!chunk)
+      throw std::runtime_error("LoadEventNexus did not give events");
+    // The first chunk carries the instrument and the logs of the run
+    if (!outputWS)
+      outputWS = create<Workspace2D>(*chunk, m_groups.size(),
+                                     HistogramData::BinEdges(edges));
+    focusChunk(*chunk, edges, counts, errorsSquared);
+    interruption_point();
+  }
+
+  Progress progress(this, 0.9, 1.0, m_groups.size());
+  for (size_t index = 0; index < m_groups.size(); ++index) {
+    auto &spectrum = outputWS->getSpectrum(index);
+    spectrum.setSpectrumNo(m_groups[index]);
+    spectrum.setDetectorIDs(std::set<detid_t>(m_groupDetIDs[index].cbegin(),
+                                              m_groupDetIDs[index].cend()));
+
+    auto &y = outputWS->mutableY(index);
+    auto &e = outputWS->mutableE(index);
+    const size_t offset = index * numBins;
+    for (size_t thread = 0; thread < numThreads; ++thread) {
+      for (size_t bin = 0; bin < numBins; ++bin) {
+        y[bin] += counts[thread][offset + bin];
+        e[bin] += errorsSquared[thread][offset + bin];
+      }
+    }
+    for (auto &value : e)
+      value = std::sqrt(value);
+    progress.report();
+  }
+  outputWS->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+
+  setProperty("OutputWorkspace", outputWS);
+}
+
+} // namespace WorkflowAlgorithms
+} // namespace Mantid
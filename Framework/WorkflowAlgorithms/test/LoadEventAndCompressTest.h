@@ -13,6 +13,8 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidWorkflowAlgorithms/LoadEventAndCompress.h"
 
+#include <numeric>
+
 using Mantid::WorkflowAlgorithms::LoadEventAndCompress;
 using namespace Mantid::DataObjects;
 using namespace Mantid::API;
@@ -131,4 +133,51 @@ public:
     // Remove workspace from the data service.
     AnalysisDataService::Instance().remove(WS_NAME);
   }
+
+  void test_linear_binning_with_default_FilterBadPulses_is_rejected() {
+    LoadEventAndCompress alg;
+    alg.setChild(true);
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Filename", FILENAME));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "unused"));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("CompressBinningMode", "Linear"));
+
+    IAlgorithm &ialg = alg;
+    const auto errors = ialg.validateInputs();
+    TS_ASSERT_EQUALS(errors.count("CompressBinningMode"), 1);
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+    TS_ASSERT(!alg.isExecuted());
+  }
+
+  void test_linear_binning_without_FilterBadPulses() {
+    LoadEventAndCompress alg;
+    alg.setChild(true);
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Filename", FILENAME));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "unused"));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("CompressBinningMode", "Linear"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("FilterBadPulses", "0"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("MaxChunkSize", CHUNKSIZE));
+    IAlgorithm &ialg = alg;
+    TS_ASSERT(ialg.validateInputs().empty());
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    Workspace_sptr output = alg.getProperty("OutputWorkspace");
+    auto wksp = std::dynamic_pointer_cast<EventWorkspace>(output);
+    TS_ASSERT(wksp);
+    if (!wksp)
+      return;
+    TS_ASSERT_EQUALS(wksp->getEventType(), EventType::WEIGHTED_NOTIME);
+    // Binning merges events but keeps their total weight
+    TS_ASSERT(wksp->getNumberEvents() <= NUMEVENTS);
+    double weight = 0.;
+    for (size_t i = 0; i < wksp->getNumberHistograms(); ++i) {
+      const auto weights = wksp->getSpectrum(i).getWeights();
+      weight += std::accumulate(weights.cbegin(), weights.cend(), 0.);
+    }
+    TS_ASSERT_DELTA(weight, static_cast<double>(NUMEVENTS), 1e-6);
+  }
 };
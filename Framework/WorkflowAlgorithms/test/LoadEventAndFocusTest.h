@@ -0,0 +1,220 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/TableRow.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/Unit.h"
+#include "MantidWorkflowAlgorithms/LoadEventAndFocus.h"
+
+#include <map>
+
+using Mantid::WorkflowAlgorithms::LoadEventAndFocus;
+using namespace Mantid::DataObjects;
+using namespace Mantid::API;
+
+namespace {
+const std::string FILENAME{"ARCS_sim_event.nxs"};
+const double CHUNKSIZE{.00001}; // REALLY small file
+const std::string PARAMS{"0.1,0.1,30"};
+const double DIFC{1000.};
+} // anonymous namespace
+
+class LoadEventAndFocusTest : public CxxTest::TestSuite {
+
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LoadEventAndFocusTest *createSuite() {
+    return new LoadEventAndFocusTest();
+  }
+  static void destroySuite(LoadEventAndFocusTest *suite) { delete suite; }
+
+  void test_Init() {
+    LoadEventAndFocus alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    TS_ASSERT(alg.isInitialized());
+  }
+
+  void test_default_chunk_size_is_bounded() {
+    // A quarter of the available memory
+    const double chunkSize = LoadEventAndFocus::defaultMaxChunkSize();
+    TS_ASSERT_LESS_THAN(0., chunkSize);
+    Mantid::Kernel::MemoryStats memory;
+    TS_ASSERT_LESS_THAN(chunkSize, static_cast<double>(memory.totalMem()) /
+                                       (1024. * 1024.));
+
+    LoadEventAndFocus alg;
+    alg.initialize();
+    TS_ASSERT(alg.getPointerToProperty("MaxChunkSize")->isDefault());
+  }
+
+  void test_calibration_without_difc_is_rejected() {
+    auto calibration = WorkspaceFactory::Instance().createTable();
+    calibration->addColumn("int", "detid");
+
+    LoadEventAndFocus alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setPropertyValue("Filename", FILENAME);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setProperty("CalibrationWorkspace", calibration);
+    alg.setProperty("GroupingWorkspace", createGrouping());
+    alg.setPropertyValue("Params", PARAMS);
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+  }
+
+  void test_exec_matches_align_and_focus_of_the_events() {
+    auto grouping = createGrouping();
+    auto calibration = createCalibration(*grouping);
+    auto expected = alignAndFocus(calibration, grouping);
+
+    // without MaxChunkSize, then with small chunks
+    for (const double chunkSize : {0., CHUNKSIZE}) {
+      LoadEventAndFocus alg;
+      alg.setChild(true);
+      TS_ASSERT_THROWS_NOTHING(alg.initialize());
+      TS_ASSERT(alg.isInitialized());
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Filename", FILENAME));
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setPropertyValue("OutputWorkspace", "unused"));
+      if (chunkSize > 0.)
+        TS_ASSERT_THROWS_NOTHING(alg.setProperty("MaxChunkSize", chunkSize));
+      TS_ASSERT_THROWS_NOTHING(
+          alg.setProperty("CalibrationWorkspace", calibration));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("GroupingWorkspace", grouping));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Params", PARAMS));
+      TS_ASSERT_THROWS_NOTHING(alg.execute(););
+      TS_ASSERT(alg.isExecuted());
+
+      MatrixWorkspace_sptr focused = alg.getProperty("OutputWorkspace");
+      TS_ASSERT(focused);
+      if (!focused)
+        return;
+      TS_ASSERT_EQUALS(focused->getAxis(0)->unit()->unitID(), "dSpacing");
+      compare(*focused, *expected);
+    }
+  }
+
+private:
+  GroupingWorkspace_sptr createGrouping() {
+    auto load = AlgorithmManager::Instance().createUnmanaged("LoadEventNexus");
+    load->setChild(true);
+    load->initialize();
+    load->setPropertyValue("Filename", FILENAME);
+    load->setPropertyValue("OutputWorkspace", "unused");
+    load->setProperty("MetaDataOnly", true);
+    load->execute();
+    Workspace_sptr events = load->getProperty("OutputWorkspace");
+
+    auto create =
+        AlgorithmManager::Instance().createUnmanaged("CreateGroupingWorkspace");
+    create->setChild(true);
+    create->initialize();
+    create->setProperty("InputWorkspace", events);
+    create->setPropertyValue("GroupDetectorsBy", "bank");
+    create->setPropertyValue("OutputWorkspace", "unused");
+    create->execute();
+    return create->getProperty("OutputWorkspace");
+  }
+
+  ITableWorkspace_sptr createCalibration(const GroupingWorkspace &grouping) {
+    auto calibration = WorkspaceFactory::Instance().createTable();
+    calibration->addColumn("int", "detid");
+    calibration->addColumn("double", "difc");
+    calibration->addColumn("double", "difa");
+    calibration->addColumn("double", "tzero");
+    for (size_t i = 0; i < grouping.getNumberHistograms(); ++i) {
+      for (const auto detID : grouping.getSpectrum(i).getDetectorIDs()) {
+        TableRow row = calibration->appendRow();
+        row << static_cast<int>(detID) << DIFC << 0. << 0.;
+      }
+    }
+    return calibration;
+  }
+
+  MatrixWorkspace_sptr alignAndFocus(const ITableWorkspace_sptr &calibration,
+                                     const GroupingWorkspace_sptr &grouping) {
+    auto load = AlgorithmManager::Instance().createUnmanaged("LoadEventNexus");
+    load->setChild(true);
+    load->initialize();
+    load->setPropertyValue("Filename", FILENAME);
+    load->setPropertyValue("OutputWorkspace", "unused");
+    load->execute();
+    Workspace_sptr events = load->getProperty("OutputWorkspace");
+
+    auto align = AlgorithmManager::Instance().createUnmanaged("AlignDetectors");
+    align->setChild(true);
+    align->initialize();
+    align->setProperty("InputWorkspace",
+                       std::dynamic_pointer_cast<MatrixWorkspace>(events));
+    align->setProperty("CalibrationWorkspace", calibration);
+    align->setPropertyValue("OutputWorkspace", "unused");
+    align->execute();
+    MatrixWorkspace_sptr aligned = align->getProperty("OutputWorkspace");
+
+    auto focus =
+        AlgorithmManager::Instance().createUnmanaged("DiffractionFocussing", 2);
+    focus->setChild(true);
+    focus->initialize();
+    focus->setProperty("InputWorkspace", aligned);
+    focus->setProperty("GroupingWorkspace", grouping);
+    focus->setPropertyValue("OutputWorkspace", "unused");
+    focus->execute();
+    MatrixWorkspace_sptr focused = focus->getProperty("OutputWorkspace");
+
+    auto rebin = AlgorithmManager::Instance().createUnmanaged("Rebin");
+    rebin->setChild(true);
+    rebin->initialize();
+    rebin->setProperty("InputWorkspace", focused);
+    rebin->setPropertyValue("Params", PARAMS);
+    rebin->setProperty("PreserveEvents", false);
+    rebin->setPropertyValue("OutputWorkspace", "unused");
+    rebin->execute();
+    return rebin->getProperty("OutputWorkspace");
+  }
+
+  void compare(const MatrixWorkspace &focused,
+               const MatrixWorkspace &expected) {
+    std::map<Mantid::specnum_t, size_t> expectedIndices;
+    for (size_t i = 0; i < expected.getNumberHistograms(); ++i)
+      expectedIndices[expected.getSpectrum(i).getSpectrumNo()] = i;
+    TS_ASSERT_EQUALS(focused.getNumberHistograms(), expectedIndices.size());
+
+    double total = 0.;
+    for (size_t i = 0; i < focused.getNumberHistograms(); ++i) {
+      const auto &spectrum = focused.getSpectrum(i);
+      const auto found = expectedIndices.find(spectrum.getSpectrumNo());
+      TS_ASSERT(found != expectedIndices.end());
+      if (found == expectedIndices.end())
+        continue;
+      const auto &expectedSpectrum = expected.getSpectrum(found->second);
+      TS_ASSERT_EQUALS(spectrum.getDetectorIDs(),
+                       expectedSpectrum.getDetectorIDs());
+      TS_ASSERT_EQUALS(spectrum.x(), expectedSpectrum.x());
+      const auto &y = spectrum.y();
+      const auto &e = spectrum.e();
+      const auto &expectedY = expectedSpectrum.y();
+      const auto &expectedE = expectedSpectrum.e();
+      for (size_t bin = 0; bin < y.size(); ++bin) {
+        TS_ASSERT_DELTA(y[bin], expectedY[bin], 1e-9);
+        TS_ASSERT_DELTA(e[bin], expectedE[bin], 1e-9);
+        total += y[bin];
+      }
+    }
+    TS_ASSERT(total > 0.);
+  }
+};